@@ -0,0 +1,29 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/common/mqtt_list.c" "common/CMakeFiles/mc-common.dir/mqtt_list.c.o" "gcc" "common/CMakeFiles/mc-common.dir/mqtt_list.c.o.d"
+  "/root/repo/common/mqtt_ring.c" "common/CMakeFiles/mc-common.dir/mqtt_ring.c.o" "gcc" "common/CMakeFiles/mc-common.dir/mqtt_ring.c.o.d"
+  "/root/repo/common/mqtt_wheel.c" "common/CMakeFiles/mc-common.dir/mqtt_wheel.c.o" "gcc" "common/CMakeFiles/mc-common.dir/mqtt_wheel.c.o.d"
+  "/root/repo/common/random.c" "common/CMakeFiles/mc-common.dir/random.c.o" "gcc" "common/CMakeFiles/mc-common.dir/random.c.o.d"
+  )
+
+# Pairs of files generated by the same build rule.
+set(CMAKE_MULTIPLE_OUTPUT_PAIRS
+  "/root/repo/build/lib/libmc-common.so" "/root/repo/build/lib/libmc-common.so.1.2.0"
+  )
+
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_full_build/common/log/CMakeFiles/mc-log.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,18 @@
+file(REMOVE_RECURSE
+  "/root/repo/build/lib/libmc-common.pdb"
+  "/root/repo/build/lib/libmc-common.so"
+  "/root/repo/build/lib/libmc-common.so.1.2.0"
+  "CMakeFiles/mc-common.dir/mqtt_list.c.o"
+  "CMakeFiles/mc-common.dir/mqtt_list.c.o.d"
+  "CMakeFiles/mc-common.dir/mqtt_ring.c.o"
+  "CMakeFiles/mc-common.dir/mqtt_ring.c.o.d"
+  "CMakeFiles/mc-common.dir/mqtt_wheel.c.o"
+  "CMakeFiles/mc-common.dir/mqtt_wheel.c.o.d"
+  "CMakeFiles/mc-common.dir/random.c.o"
+  "CMakeFiles/mc-common.dir/random.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/mc-common.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
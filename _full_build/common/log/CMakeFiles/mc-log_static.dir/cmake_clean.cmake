@@ -0,0 +1,17 @@
+file(REMOVE_RECURSE
+  "/root/repo/build/lib/libmc-log.a"
+  "/root/repo/build/lib/libmc-log.pdb"
+  "CMakeFiles/mc-log_static.dir/arch/linux/arch.c.o"
+  "CMakeFiles/mc-log_static.dir/arch/linux/arch.c.o.d"
+  "CMakeFiles/mc-log_static.dir/fifo.c.o"
+  "CMakeFiles/mc-log_static.dir/fifo.c.o.d"
+  "CMakeFiles/mc-log_static.dir/format.c.o"
+  "CMakeFiles/mc-log_static.dir/format.c.o.d"
+  "CMakeFiles/mc-log_static.dir/salof.c.o"
+  "CMakeFiles/mc-log_static.dir/salof.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/mc-log_static.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
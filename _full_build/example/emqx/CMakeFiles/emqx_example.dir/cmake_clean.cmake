@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "/root/repo/build/bin/emqx_example"
+  "/root/repo/build/bin/emqx_example.pdb"
+  "CMakeFiles/emqx_example.dir/emqx.c.o"
+  "CMakeFiles/emqx_example.dir/emqx.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/emqx_example.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
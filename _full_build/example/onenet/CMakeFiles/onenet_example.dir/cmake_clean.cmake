@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "/root/repo/build/bin/onenet_example"
+  "/root/repo/build/bin/onenet_example.pdb"
+  "CMakeFiles/onenet_example.dir/onenet.c.o"
+  "CMakeFiles/onenet_example.dir/onenet.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/onenet_example.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,34 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/mqtt/MQTTConnectClient.c" "mqtt/CMakeFiles/mc-mqtt.dir/MQTTConnectClient.c.o" "gcc" "mqtt/CMakeFiles/mc-mqtt.dir/MQTTConnectClient.c.o.d"
+  "/root/repo/mqtt/MQTTConnectServer.c" "mqtt/CMakeFiles/mc-mqtt.dir/MQTTConnectServer.c.o" "gcc" "mqtt/CMakeFiles/mc-mqtt.dir/MQTTConnectServer.c.o.d"
+  "/root/repo/mqtt/MQTTDeserializePublish.c" "mqtt/CMakeFiles/mc-mqtt.dir/MQTTDeserializePublish.c.o" "gcc" "mqtt/CMakeFiles/mc-mqtt.dir/MQTTDeserializePublish.c.o.d"
+  "/root/repo/mqtt/MQTTFormat.c" "mqtt/CMakeFiles/mc-mqtt.dir/MQTTFormat.c.o" "gcc" "mqtt/CMakeFiles/mc-mqtt.dir/MQTTFormat.c.o.d"
+  "/root/repo/mqtt/MQTTPacket.c" "mqtt/CMakeFiles/mc-mqtt.dir/MQTTPacket.c.o" "gcc" "mqtt/CMakeFiles/mc-mqtt.dir/MQTTPacket.c.o.d"
+  "/root/repo/mqtt/MQTTSerializePublish.c" "mqtt/CMakeFiles/mc-mqtt.dir/MQTTSerializePublish.c.o" "gcc" "mqtt/CMakeFiles/mc-mqtt.dir/MQTTSerializePublish.c.o.d"
+  "/root/repo/mqtt/MQTTSubscribeClient.c" "mqtt/CMakeFiles/mc-mqtt.dir/MQTTSubscribeClient.c.o" "gcc" "mqtt/CMakeFiles/mc-mqtt.dir/MQTTSubscribeClient.c.o.d"
+  "/root/repo/mqtt/MQTTSubscribeServer.c" "mqtt/CMakeFiles/mc-mqtt.dir/MQTTSubscribeServer.c.o" "gcc" "mqtt/CMakeFiles/mc-mqtt.dir/MQTTSubscribeServer.c.o.d"
+  "/root/repo/mqtt/MQTTUnsubscribeClient.c" "mqtt/CMakeFiles/mc-mqtt.dir/MQTTUnsubscribeClient.c.o" "gcc" "mqtt/CMakeFiles/mc-mqtt.dir/MQTTUnsubscribeClient.c.o.d"
+  "/root/repo/mqtt/MQTTUnsubscribeServer.c" "mqtt/CMakeFiles/mc-mqtt.dir/MQTTUnsubscribeServer.c.o" "gcc" "mqtt/CMakeFiles/mc-mqtt.dir/MQTTUnsubscribeServer.c.o.d"
+  )
+
+# Pairs of files generated by the same build rule.
+set(CMAKE_MULTIPLE_OUTPUT_PAIRS
+  "/root/repo/build/lib/libmc-mqtt.so" "/root/repo/build/lib/libmc-mqtt.so.1.2.0"
+  )
+
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
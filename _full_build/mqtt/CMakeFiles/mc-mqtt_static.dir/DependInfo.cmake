@@ -0,0 +1,28 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/mqtt/MQTTConnectClient.c" "mqtt/CMakeFiles/mc-mqtt_static.dir/MQTTConnectClient.c.o" "gcc" "mqtt/CMakeFiles/mc-mqtt_static.dir/MQTTConnectClient.c.o.d"
+  "/root/repo/mqtt/MQTTConnectServer.c" "mqtt/CMakeFiles/mc-mqtt_static.dir/MQTTConnectServer.c.o" "gcc" "mqtt/CMakeFiles/mc-mqtt_static.dir/MQTTConnectServer.c.o.d"
+  "/root/repo/mqtt/MQTTDeserializePublish.c" "mqtt/CMakeFiles/mc-mqtt_static.dir/MQTTDeserializePublish.c.o" "gcc" "mqtt/CMakeFiles/mc-mqtt_static.dir/MQTTDeserializePublish.c.o.d"
+  "/root/repo/mqtt/MQTTFormat.c" "mqtt/CMakeFiles/mc-mqtt_static.dir/MQTTFormat.c.o" "gcc" "mqtt/CMakeFiles/mc-mqtt_static.dir/MQTTFormat.c.o.d"
+  "/root/repo/mqtt/MQTTPacket.c" "mqtt/CMakeFiles/mc-mqtt_static.dir/MQTTPacket.c.o" "gcc" "mqtt/CMakeFiles/mc-mqtt_static.dir/MQTTPacket.c.o.d"
+  "/root/repo/mqtt/MQTTSerializePublish.c" "mqtt/CMakeFiles/mc-mqtt_static.dir/MQTTSerializePublish.c.o" "gcc" "mqtt/CMakeFiles/mc-mqtt_static.dir/MQTTSerializePublish.c.o.d"
+  "/root/repo/mqtt/MQTTSubscribeClient.c" "mqtt/CMakeFiles/mc-mqtt_static.dir/MQTTSubscribeClient.c.o" "gcc" "mqtt/CMakeFiles/mc-mqtt_static.dir/MQTTSubscribeClient.c.o.d"
+  "/root/repo/mqtt/MQTTSubscribeServer.c" "mqtt/CMakeFiles/mc-mqtt_static.dir/MQTTSubscribeServer.c.o" "gcc" "mqtt/CMakeFiles/mc-mqtt_static.dir/MQTTSubscribeServer.c.o.d"
+  "/root/repo/mqtt/MQTTUnsubscribeClient.c" "mqtt/CMakeFiles/mc-mqtt_static.dir/MQTTUnsubscribeClient.c.o" "gcc" "mqtt/CMakeFiles/mc-mqtt_static.dir/MQTTUnsubscribeClient.c.o.d"
+  "/root/repo/mqtt/MQTTUnsubscribeServer.c" "mqtt/CMakeFiles/mc-mqtt_static.dir/MQTTUnsubscribeServer.c.o" "gcc" "mqtt/CMakeFiles/mc-mqtt_static.dir/MQTTUnsubscribeServer.c.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
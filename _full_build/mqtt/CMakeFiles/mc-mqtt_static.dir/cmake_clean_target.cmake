@@ -0,0 +1,3 @@
+file(REMOVE_RECURSE
+  "/root/repo/build/lib/libmc-mqtt.a"
+)
@@ -0,0 +1,35 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/mqttclient/mqtt_group.c" "mqttclient/CMakeFiles/mc-mqttclient.dir/mqtt_group.c.o" "gcc" "mqttclient/CMakeFiles/mc-mqttclient.dir/mqtt_group.c.o.d"
+  "/root/repo/mqttclient/mqtt_pool.c" "mqttclient/CMakeFiles/mc-mqttclient.dir/mqtt_pool.c.o" "gcc" "mqttclient/CMakeFiles/mc-mqttclient.dir/mqtt_pool.c.o.d"
+  "/root/repo/mqttclient/mqtt_reactor.c" "mqttclient/CMakeFiles/mc-mqttclient.dir/mqtt_reactor.c.o" "gcc" "mqttclient/CMakeFiles/mc-mqttclient.dir/mqtt_reactor.c.o.d"
+  "/root/repo/mqttclient/mqtt_topic_tree.c" "mqttclient/CMakeFiles/mc-mqttclient.dir/mqtt_topic_tree.c.o" "gcc" "mqttclient/CMakeFiles/mc-mqttclient.dir/mqtt_topic_tree.c.o.d"
+  "/root/repo/mqttclient/mqttclient.c" "mqttclient/CMakeFiles/mc-mqttclient.dir/mqttclient.c.o" "gcc" "mqttclient/CMakeFiles/mc-mqttclient.dir/mqttclient.c.o.d"
+  )
+
+# Pairs of files generated by the same build rule.
+set(CMAKE_MULTIPLE_OUTPUT_PAIRS
+  "/root/repo/build/lib/libmc-mqttclient.so" "/root/repo/build/lib/libmc-mqttclient.so.1.2.0"
+  )
+
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_full_build/mqtt/CMakeFiles/mc-mqtt.dir/DependInfo.cmake"
+  "/root/repo/_full_build/network/CMakeFiles/mc-network.dir/DependInfo.cmake"
+  "/root/repo/_full_build/network/mbedtls/CMakeFiles/mc-mbedtls.dir/DependInfo.cmake"
+  "/root/repo/_full_build/platform/CMakeFiles/mc-platform.dir/DependInfo.cmake"
+  "/root/repo/_full_build/common/CMakeFiles/mc-common.dir/DependInfo.cmake"
+  "/root/repo/_full_build/common/log/CMakeFiles/mc-log.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
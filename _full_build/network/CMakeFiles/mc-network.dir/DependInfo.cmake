@@ -0,0 +1,31 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/network/nettype_tcp.c" "network/CMakeFiles/mc-network.dir/nettype_tcp.c.o" "gcc" "network/CMakeFiles/mc-network.dir/nettype_tcp.c.o.d"
+  "/root/repo/network/nettype_tls.c" "network/CMakeFiles/mc-network.dir/nettype_tls.c.o" "gcc" "network/CMakeFiles/mc-network.dir/nettype_tls.c.o.d"
+  "/root/repo/network/network.c" "network/CMakeFiles/mc-network.dir/network.c.o" "gcc" "network/CMakeFiles/mc-network.dir/network.c.o.d"
+  )
+
+# Pairs of files generated by the same build rule.
+set(CMAKE_MULTIPLE_OUTPUT_PAIRS
+  "/root/repo/build/lib/libmc-network.so" "/root/repo/build/lib/libmc-network.so.1.2.0"
+  )
+
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_full_build/network/mbedtls/CMakeFiles/mc-mbedtls.dir/DependInfo.cmake"
+  "/root/repo/_full_build/platform/CMakeFiles/mc-platform.dir/DependInfo.cmake"
+  "/root/repo/_full_build/common/CMakeFiles/mc-common.dir/DependInfo.cmake"
+  "/root/repo/_full_build/common/log/CMakeFiles/mc-log.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
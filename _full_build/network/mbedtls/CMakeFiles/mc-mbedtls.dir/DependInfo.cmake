@@ -0,0 +1,109 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/network/mbedtls/library/aes.c" "network/mbedtls/CMakeFiles/mc-mbedtls.dir/library/aes.c.o" "gcc" "network/mbedtls/CMakeFiles/mc-mbedtls.dir/library/aes.c.o.d"
+  "/root/repo/network/mbedtls/library/aesni.c" "network/mbedtls/CMakeFiles/mc-mbedtls.dir/library/aesni.c.o" "gcc" "network/mbedtls/CMakeFiles/mc-mbedtls.dir/library/aesni.c.o.d"
+  "/root/repo/network/mbedtls/library/arc4.c" "network/mbedtls/CMakeFiles/mc-mbedtls.dir/library/arc4.c.o" "gcc" "network/mbedtls/CMakeFiles/mc-mbedtls.dir/library/arc4.c.o.d"
+  "/root/repo/network/mbedtls/library/aria.c" "network/mbedtls/CMakeFiles/mc-mbedtls.dir/library/aria.c.o" "gcc" "network/mbedtls/CMakeFiles/mc-mbedtls.dir/library/aria.c.o.d"
+  "/root/repo/network/mbedtls/library/asn1parse.c" "network/mbedtls/CMakeFiles/mc-mbedtls.dir/library/asn1parse.c.o" "gcc" "network/mbedtls/CMakeFiles/mc-mbedtls.dir/library/asn1parse.c.o.d"
+  "/root/repo/network/mbedtls/library/asn1write.c" "network/mbedtls/CMakeFiles/mc-mbedtls.dir/library/asn1write.c.o" "gcc" "network/mbedtls/CMakeFiles/mc-mbedtls.dir/library/asn1write.c.o.d"
+  "/root/repo/network/mbedtls/library/base64.c" "network/mbedtls/CMakeFiles/mc-mbedtls.dir/library/base64.c.o" "gcc" "network/mbedtls/CMakeFiles/mc-mbedtls.dir/library/base64.c.o.d"
+  "/root/repo/network/mbedtls/library/bignum.c" "network/mbedtls/CMakeFiles/mc-mbedtls.dir/library/bignum.c.o" "gcc" "network/mbedtls/CMakeFiles/mc-mbedtls.dir/library/bignum.c.o.d"
+  "/root/repo/network/mbedtls/library/blowfish.c" "network/mbedtls/CMakeFiles/mc-mbedtls.dir/library/blowfish.c.o" "gcc" "network/mbedtls/CMakeFiles/mc-mbedtls.dir/library/blowfish.c.o.d"
+  "/root/repo/network/mbedtls/library/camellia.c" "network/mbedtls/CMakeFiles/mc-mbedtls.dir/library/camellia.c.o" "gcc" "network/mbedtls/CMakeFiles/mc-mbedtls.dir/library/camellia.c.o.d"
+  "/root/repo/network/mbedtls/library/ccm.c" "network/mbedtls/CMakeFiles/mc-mbedtls.dir/library/ccm.c.o" "gcc" "network/mbedtls/CMakeFiles/mc-mbedtls.dir/library/ccm.c.o.d"
+  "/root/repo/network/mbedtls/library/certs.c" "network/mbedtls/CMakeFiles/mc-mbedtls.dir/library/certs.c.o" "gcc" "network/mbedtls/CMakeFiles/mc-mbedtls.dir/library/certs.c.o.d"
+  "/root/repo/network/mbedtls/library/chacha20.c" "network/mbedtls/CMakeFiles/mc-mbedtls.dir/library/chacha20.c.o" "gcc" "network/mbedtls/CMakeFiles/mc-mbedtls.dir/library/chacha20.c.o.d"
+  "/root/repo/network/mbedtls/library/chachapoly.c" "network/mbedtls/CMakeFiles/mc-mbedtls.dir/library/chachapoly.c.o" "gcc" "network/mbedtls/CMakeFiles/mc-mbedtls.dir/library/chachapoly.c.o.d"
+  "/root/repo/network/mbedtls/library/cipher.c" "network/mbedtls/CMakeFiles/mc-mbedtls.dir/library/cipher.c.o" "gcc" "network/mbedtls/CMakeFiles/mc-mbedtls.dir/library/cipher.c.o.d"
+  "/root/repo/network/mbedtls/library/cipher_wrap.c" "network/mbedtls/CMakeFiles/mc-mbedtls.dir/library/cipher_wrap.c.o" "gcc" "network/mbedtls/CMakeFiles/mc-mbedtls.dir/library/cipher_wrap.c.o.d"
+  "/root/repo/network/mbedtls/library/cmac.c" "network/mbedtls/CMakeFiles/mc-mbedtls.dir/library/cmac.c.o" "gcc" "network/mbedtls/CMakeFiles/mc-mbedtls.dir/library/cmac.c.o.d"
+  "/root/repo/network/mbedtls/library/ctr_drbg.c" "network/mbedtls/CMakeFiles/mc-mbedtls.dir/library/ctr_drbg.c.o" "gcc" "network/mbedtls/CMakeFiles/mc-mbedtls.dir/library/ctr_drbg.c.o.d"
+  "/root/repo/network/mbedtls/library/debug.c" "network/mbedtls/CMakeFiles/mc-mbedtls.dir/library/debug.c.o" "gcc" "network/mbedtls/CMakeFiles/mc-mbedtls.dir/library/debug.c.o.d"
+  "/root/repo/network/mbedtls/library/des.c" "network/mbedtls/CMakeFiles/mc-mbedtls.dir/library/des.c.o" "gcc" "network/mbedtls/CMakeFiles/mc-mbedtls.dir/library/des.c.o.d"
+  "/root/repo/network/mbedtls/library/dhm.c" "network/mbedtls/CMakeFiles/mc-mbedtls.dir/library/dhm.c.o" "gcc" "network/mbedtls/CMakeFiles/mc-mbedtls.dir/library/dhm.c.o.d"
+  "/root/repo/network/mbedtls/library/ecdh.c" "network/mbedtls/CMakeFiles/mc-mbedtls.dir/library/ecdh.c.o" "gcc" "network/mbedtls/CMakeFiles/mc-mbedtls.dir/library/ecdh.c.o.d"
+  "/root/repo/network/mbedtls/library/ecdsa.c" "network/mbedtls/CMakeFiles/mc-mbedtls.dir/library/ecdsa.c.o" "gcc" "network/mbedtls/CMakeFiles/mc-mbedtls.dir/library/ecdsa.c.o.d"
+  "/root/repo/network/mbedtls/library/ecjpake.c" "network/mbedtls/CMakeFiles/mc-mbedtls.dir/library/ecjpake.c.o" "gcc" "network/mbedtls/CMakeFiles/mc-mbedtls.dir/library/ecjpake.c.o.d"
+  "/root/repo/network/mbedtls/library/ecp.c" "network/mbedtls/CMakeFiles/mc-mbedtls.dir/library/ecp.c.o" "gcc" "network/mbedtls/CMakeFiles/mc-mbedtls.dir/library/ecp.c.o.d"
+  "/root/repo/network/mbedtls/library/ecp_curves.c" "network/mbedtls/CMakeFiles/mc-mbedtls.dir/library/ecp_curves.c.o" "gcc" "network/mbedtls/CMakeFiles/mc-mbedtls.dir/library/ecp_curves.c.o.d"
+  "/root/repo/network/mbedtls/library/entropy.c" "network/mbedtls/CMakeFiles/mc-mbedtls.dir/library/entropy.c.o" "gcc" "network/mbedtls/CMakeFiles/mc-mbedtls.dir/library/entropy.c.o.d"
+  "/root/repo/network/mbedtls/library/entropy_poll.c" "network/mbedtls/CMakeFiles/mc-mbedtls.dir/library/entropy_poll.c.o" "gcc" "network/mbedtls/CMakeFiles/mc-mbedtls.dir/library/entropy_poll.c.o.d"
+  "/root/repo/network/mbedtls/library/error.c" "network/mbedtls/CMakeFiles/mc-mbedtls.dir/library/error.c.o" "gcc" "network/mbedtls/CMakeFiles/mc-mbedtls.dir/library/error.c.o.d"
+  "/root/repo/network/mbedtls/library/gcm.c" "network/mbedtls/CMakeFiles/mc-mbedtls.dir/library/gcm.c.o" "gcc" "network/mbedtls/CMakeFiles/mc-mbedtls.dir/library/gcm.c.o.d"
+  "/root/repo/network/mbedtls/library/havege.c" "network/mbedtls/CMakeFiles/mc-mbedtls.dir/library/havege.c.o" "gcc" "network/mbedtls/CMakeFiles/mc-mbedtls.dir/library/havege.c.o.d"
+  "/root/repo/network/mbedtls/library/hkdf.c" "network/mbedtls/CMakeFiles/mc-mbedtls.dir/library/hkdf.c.o" "gcc" "network/mbedtls/CMakeFiles/mc-mbedtls.dir/library/hkdf.c.o.d"
+  "/root/repo/network/mbedtls/library/hmac_drbg.c" "network/mbedtls/CMakeFiles/mc-mbedtls.dir/library/hmac_drbg.c.o" "gcc" "network/mbedtls/CMakeFiles/mc-mbedtls.dir/library/hmac_drbg.c.o.d"
+  "/root/repo/network/mbedtls/library/md.c" "network/mbedtls/CMakeFiles/mc-mbedtls.dir/library/md.c.o" "gcc" "network/mbedtls/CMakeFiles/mc-mbedtls.dir/library/md.c.o.d"
+  "/root/repo/network/mbedtls/library/md2.c" "network/mbedtls/CMakeFiles/mc-mbedtls.dir/library/md2.c.o" "gcc" "network/mbedtls/CMakeFiles/mc-mbedtls.dir/library/md2.c.o.d"
+  "/root/repo/network/mbedtls/library/md4.c" "network/mbedtls/CMakeFiles/mc-mbedtls.dir/library/md4.c.o" "gcc" "network/mbedtls/CMakeFiles/mc-mbedtls.dir/library/md4.c.o.d"
+  "/root/repo/network/mbedtls/library/md5.c" "network/mbedtls/CMakeFiles/mc-mbedtls.dir/library/md5.c.o" "gcc" "network/mbedtls/CMakeFiles/mc-mbedtls.dir/library/md5.c.o.d"
+  "/root/repo/network/mbedtls/library/md_wrap.c" "network/mbedtls/CMakeFiles/mc-mbedtls.dir/library/md_wrap.c.o" "gcc" "network/mbedtls/CMakeFiles/mc-mbedtls.dir/library/md_wrap.c.o.d"
+  "/root/repo/network/mbedtls/library/memory_buffer_alloc.c" "network/mbedtls/CMakeFiles/mc-mbedtls.dir/library/memory_buffer_alloc.c.o" "gcc" "network/mbedtls/CMakeFiles/mc-mbedtls.dir/library/memory_buffer_alloc.c.o.d"
+  "/root/repo/network/mbedtls/library/net_sockets.c" "network/mbedtls/CMakeFiles/mc-mbedtls.dir/library/net_sockets.c.o" "gcc" "network/mbedtls/CMakeFiles/mc-mbedtls.dir/library/net_sockets.c.o.d"
+  "/root/repo/network/mbedtls/library/nist_kw.c" "network/mbedtls/CMakeFiles/mc-mbedtls.dir/library/nist_kw.c.o" "gcc" "network/mbedtls/CMakeFiles/mc-mbedtls.dir/library/nist_kw.c.o.d"
+  "/root/repo/network/mbedtls/library/oid.c" "network/mbedtls/CMakeFiles/mc-mbedtls.dir/library/oid.c.o" "gcc" "network/mbedtls/CMakeFiles/mc-mbedtls.dir/library/oid.c.o.d"
+  "/root/repo/network/mbedtls/library/padlock.c" "network/mbedtls/CMakeFiles/mc-mbedtls.dir/library/padlock.c.o" "gcc" "network/mbedtls/CMakeFiles/mc-mbedtls.dir/library/padlock.c.o.d"
+  "/root/repo/network/mbedtls/library/pem.c" "network/mbedtls/CMakeFiles/mc-mbedtls.dir/library/pem.c.o" "gcc" "network/mbedtls/CMakeFiles/mc-mbedtls.dir/library/pem.c.o.d"
+  "/root/repo/network/mbedtls/library/pk.c" "network/mbedtls/CMakeFiles/mc-mbedtls.dir/library/pk.c.o" "gcc" "network/mbedtls/CMakeFiles/mc-mbedtls.dir/library/pk.c.o.d"
+  "/root/repo/network/mbedtls/library/pk_wrap.c" "network/mbedtls/CMakeFiles/mc-mbedtls.dir/library/pk_wrap.c.o" "gcc" "network/mbedtls/CMakeFiles/mc-mbedtls.dir/library/pk_wrap.c.o.d"
+  "/root/repo/network/mbedtls/library/pkcs11.c" "network/mbedtls/CMakeFiles/mc-mbedtls.dir/library/pkcs11.c.o" "gcc" "network/mbedtls/CMakeFiles/mc-mbedtls.dir/library/pkcs11.c.o.d"
+  "/root/repo/network/mbedtls/library/pkcs12.c" "network/mbedtls/CMakeFiles/mc-mbedtls.dir/library/pkcs12.c.o" "gcc" "network/mbedtls/CMakeFiles/mc-mbedtls.dir/library/pkcs12.c.o.d"
+  "/root/repo/network/mbedtls/library/pkcs5.c" "network/mbedtls/CMakeFiles/mc-mbedtls.dir/library/pkcs5.c.o" "gcc" "network/mbedtls/CMakeFiles/mc-mbedtls.dir/library/pkcs5.c.o.d"
+  "/root/repo/network/mbedtls/library/pkparse.c" "network/mbedtls/CMakeFiles/mc-mbedtls.dir/library/pkparse.c.o" "gcc" "network/mbedtls/CMakeFiles/mc-mbedtls.dir/library/pkparse.c.o.d"
+  "/root/repo/network/mbedtls/library/pkwrite.c" "network/mbedtls/CMakeFiles/mc-mbedtls.dir/library/pkwrite.c.o" "gcc" "network/mbedtls/CMakeFiles/mc-mbedtls.dir/library/pkwrite.c.o.d"
+  "/root/repo/network/mbedtls/library/platform.c" "network/mbedtls/CMakeFiles/mc-mbedtls.dir/library/platform.c.o" "gcc" "network/mbedtls/CMakeFiles/mc-mbedtls.dir/library/platform.c.o.d"
+  "/root/repo/network/mbedtls/library/platform_util.c" "network/mbedtls/CMakeFiles/mc-mbedtls.dir/library/platform_util.c.o" "gcc" "network/mbedtls/CMakeFiles/mc-mbedtls.dir/library/platform_util.c.o.d"
+  "/root/repo/network/mbedtls/library/poly1305.c" "network/mbedtls/CMakeFiles/mc-mbedtls.dir/library/poly1305.c.o" "gcc" "network/mbedtls/CMakeFiles/mc-mbedtls.dir/library/poly1305.c.o.d"
+  "/root/repo/network/mbedtls/library/ripemd160.c" "network/mbedtls/CMakeFiles/mc-mbedtls.dir/library/ripemd160.c.o" "gcc" "network/mbedtls/CMakeFiles/mc-mbedtls.dir/library/ripemd160.c.o.d"
+  "/root/repo/network/mbedtls/library/rsa.c" "network/mbedtls/CMakeFiles/mc-mbedtls.dir/library/rsa.c.o" "gcc" "network/mbedtls/CMakeFiles/mc-mbedtls.dir/library/rsa.c.o.d"
+  "/root/repo/network/mbedtls/library/rsa_internal.c" "network/mbedtls/CMakeFiles/mc-mbedtls.dir/library/rsa_internal.c.o" "gcc" "network/mbedtls/CMakeFiles/mc-mbedtls.dir/library/rsa_internal.c.o.d"
+  "/root/repo/network/mbedtls/library/sha1.c" "network/mbedtls/CMakeFiles/mc-mbedtls.dir/library/sha1.c.o" "gcc" "network/mbedtls/CMakeFiles/mc-mbedtls.dir/library/sha1.c.o.d"
+  "/root/repo/network/mbedtls/library/sha256.c" "network/mbedtls/CMakeFiles/mc-mbedtls.dir/library/sha256.c.o" "gcc" "network/mbedtls/CMakeFiles/mc-mbedtls.dir/library/sha256.c.o.d"
+  "/root/repo/network/mbedtls/library/sha512.c" "network/mbedtls/CMakeFiles/mc-mbedtls.dir/library/sha512.c.o" "gcc" "network/mbedtls/CMakeFiles/mc-mbedtls.dir/library/sha512.c.o.d"
+  "/root/repo/network/mbedtls/library/ssl_cache.c" "network/mbedtls/CMakeFiles/mc-mbedtls.dir/library/ssl_cache.c.o" "gcc" "network/mbedtls/CMakeFiles/mc-mbedtls.dir/library/ssl_cache.c.o.d"
+  "/root/repo/network/mbedtls/library/ssl_ciphersuites.c" "network/mbedtls/CMakeFiles/mc-mbedtls.dir/library/ssl_ciphersuites.c.o" "gcc" "network/mbedtls/CMakeFiles/mc-mbedtls.dir/library/ssl_ciphersuites.c.o.d"
+  "/root/repo/network/mbedtls/library/ssl_cli.c" "network/mbedtls/CMakeFiles/mc-mbedtls.dir/library/ssl_cli.c.o" "gcc" "network/mbedtls/CMakeFiles/mc-mbedtls.dir/library/ssl_cli.c.o.d"
+  "/root/repo/network/mbedtls/library/ssl_cookie.c" "network/mbedtls/CMakeFiles/mc-mbedtls.dir/library/ssl_cookie.c.o" "gcc" "network/mbedtls/CMakeFiles/mc-mbedtls.dir/library/ssl_cookie.c.o.d"
+  "/root/repo/network/mbedtls/library/ssl_srv.c" "network/mbedtls/CMakeFiles/mc-mbedtls.dir/library/ssl_srv.c.o" "gcc" "network/mbedtls/CMakeFiles/mc-mbedtls.dir/library/ssl_srv.c.o.d"
+  "/root/repo/network/mbedtls/library/ssl_ticket.c" "network/mbedtls/CMakeFiles/mc-mbedtls.dir/library/ssl_ticket.c.o" "gcc" "network/mbedtls/CMakeFiles/mc-mbedtls.dir/library/ssl_ticket.c.o.d"
+  "/root/repo/network/mbedtls/library/ssl_tls.c" "network/mbedtls/CMakeFiles/mc-mbedtls.dir/library/ssl_tls.c.o" "gcc" "network/mbedtls/CMakeFiles/mc-mbedtls.dir/library/ssl_tls.c.o.d"
+  "/root/repo/network/mbedtls/library/threading.c" "network/mbedtls/CMakeFiles/mc-mbedtls.dir/library/threading.c.o" "gcc" "network/mbedtls/CMakeFiles/mc-mbedtls.dir/library/threading.c.o.d"
+  "/root/repo/network/mbedtls/library/timing.c" "network/mbedtls/CMakeFiles/mc-mbedtls.dir/library/timing.c.o" "gcc" "network/mbedtls/CMakeFiles/mc-mbedtls.dir/library/timing.c.o.d"
+  "/root/repo/network/mbedtls/library/version.c" "network/mbedtls/CMakeFiles/mc-mbedtls.dir/library/version.c.o" "gcc" "network/mbedtls/CMakeFiles/mc-mbedtls.dir/library/version.c.o.d"
+  "/root/repo/network/mbedtls/library/version_features.c" "network/mbedtls/CMakeFiles/mc-mbedtls.dir/library/version_features.c.o" "gcc" "network/mbedtls/CMakeFiles/mc-mbedtls.dir/library/version_features.c.o.d"
+  "/root/repo/network/mbedtls/library/x509.c" "network/mbedtls/CMakeFiles/mc-mbedtls.dir/library/x509.c.o" "gcc" "network/mbedtls/CMakeFiles/mc-mbedtls.dir/library/x509.c.o.d"
+  "/root/repo/network/mbedtls/library/x509_create.c" "network/mbedtls/CMakeFiles/mc-mbedtls.dir/library/x509_create.c.o" "gcc" "network/mbedtls/CMakeFiles/mc-mbedtls.dir/library/x509_create.c.o.d"
+  "/root/repo/network/mbedtls/library/x509_crl.c" "network/mbedtls/CMakeFiles/mc-mbedtls.dir/library/x509_crl.c.o" "gcc" "network/mbedtls/CMakeFiles/mc-mbedtls.dir/library/x509_crl.c.o.d"
+  "/root/repo/network/mbedtls/library/x509_crt.c" "network/mbedtls/CMakeFiles/mc-mbedtls.dir/library/x509_crt.c.o" "gcc" "network/mbedtls/CMakeFiles/mc-mbedtls.dir/library/x509_crt.c.o.d"
+  "/root/repo/network/mbedtls/library/x509_csr.c" "network/mbedtls/CMakeFiles/mc-mbedtls.dir/library/x509_csr.c.o" "gcc" "network/mbedtls/CMakeFiles/mc-mbedtls.dir/library/x509_csr.c.o.d"
+  "/root/repo/network/mbedtls/library/x509write_crt.c" "network/mbedtls/CMakeFiles/mc-mbedtls.dir/library/x509write_crt.c.o" "gcc" "network/mbedtls/CMakeFiles/mc-mbedtls.dir/library/x509write_crt.c.o.d"
+  "/root/repo/network/mbedtls/library/x509write_csr.c" "network/mbedtls/CMakeFiles/mc-mbedtls.dir/library/x509write_csr.c.o" "gcc" "network/mbedtls/CMakeFiles/mc-mbedtls.dir/library/x509write_csr.c.o.d"
+  "/root/repo/network/mbedtls/library/xtea.c" "network/mbedtls/CMakeFiles/mc-mbedtls.dir/library/xtea.c.o" "gcc" "network/mbedtls/CMakeFiles/mc-mbedtls.dir/library/xtea.c.o.d"
+  "/root/repo/network/mbedtls/wrapper/entropy_hardware_alt.c" "network/mbedtls/CMakeFiles/mc-mbedtls.dir/wrapper/entropy_hardware_alt.c.o" "gcc" "network/mbedtls/CMakeFiles/mc-mbedtls.dir/wrapper/entropy_hardware_alt.c.o.d"
+  "/root/repo/network/mbedtls/wrapper/net_sockets_alt.c" "network/mbedtls/CMakeFiles/mc-mbedtls.dir/wrapper/net_sockets_alt.c.o" "gcc" "network/mbedtls/CMakeFiles/mc-mbedtls.dir/wrapper/net_sockets_alt.c.o.d"
+  "/root/repo/network/mbedtls/wrapper/timing_alt.c" "network/mbedtls/CMakeFiles/mc-mbedtls.dir/wrapper/timing_alt.c.o" "gcc" "network/mbedtls/CMakeFiles/mc-mbedtls.dir/wrapper/timing_alt.c.o.d"
+  )
+
+# Pairs of files generated by the same build rule.
+set(CMAKE_MULTIPLE_OUTPUT_PAIRS
+  "/root/repo/build/lib/libmc-mbedtls.so" "/root/repo/build/lib/libmc-mbedtls.so.1.2.0"
+  )
+
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_full_build/platform/CMakeFiles/mc-platform.dir/DependInfo.cmake"
+  "/root/repo/_full_build/common/CMakeFiles/mc-common.dir/DependInfo.cmake"
+  "/root/repo/_full_build/common/log/CMakeFiles/mc-log.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
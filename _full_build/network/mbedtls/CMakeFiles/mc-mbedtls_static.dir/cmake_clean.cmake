@@ -0,0 +1,173 @@
+file(REMOVE_RECURSE
+  "/root/repo/build/lib/libmc-mbedtls.a"
+  "/root/repo/build/lib/libmc-mbedtls.pdb"
+  "CMakeFiles/mc-mbedtls_static.dir/library/aes.c.o"
+  "CMakeFiles/mc-mbedtls_static.dir/library/aes.c.o.d"
+  "CMakeFiles/mc-mbedtls_static.dir/library/aesni.c.o"
+  "CMakeFiles/mc-mbedtls_static.dir/library/aesni.c.o.d"
+  "CMakeFiles/mc-mbedtls_static.dir/library/arc4.c.o"
+  "CMakeFiles/mc-mbedtls_static.dir/library/arc4.c.o.d"
+  "CMakeFiles/mc-mbedtls_static.dir/library/aria.c.o"
+  "CMakeFiles/mc-mbedtls_static.dir/library/aria.c.o.d"
+  "CMakeFiles/mc-mbedtls_static.dir/library/asn1parse.c.o"
+  "CMakeFiles/mc-mbedtls_static.dir/library/asn1parse.c.o.d"
+  "CMakeFiles/mc-mbedtls_static.dir/library/asn1write.c.o"
+  "CMakeFiles/mc-mbedtls_static.dir/library/asn1write.c.o.d"
+  "CMakeFiles/mc-mbedtls_static.dir/library/base64.c.o"
+  "CMakeFiles/mc-mbedtls_static.dir/library/base64.c.o.d"
+  "CMakeFiles/mc-mbedtls_static.dir/library/bignum.c.o"
+  "CMakeFiles/mc-mbedtls_static.dir/library/bignum.c.o.d"
+  "CMakeFiles/mc-mbedtls_static.dir/library/blowfish.c.o"
+  "CMakeFiles/mc-mbedtls_static.dir/library/blowfish.c.o.d"
+  "CMakeFiles/mc-mbedtls_static.dir/library/camellia.c.o"
+  "CMakeFiles/mc-mbedtls_static.dir/library/camellia.c.o.d"
+  "CMakeFiles/mc-mbedtls_static.dir/library/ccm.c.o"
+  "CMakeFiles/mc-mbedtls_static.dir/library/ccm.c.o.d"
+  "CMakeFiles/mc-mbedtls_static.dir/library/certs.c.o"
+  "CMakeFiles/mc-mbedtls_static.dir/library/certs.c.o.d"
+  "CMakeFiles/mc-mbedtls_static.dir/library/chacha20.c.o"
+  "CMakeFiles/mc-mbedtls_static.dir/library/chacha20.c.o.d"
+  "CMakeFiles/mc-mbedtls_static.dir/library/chachapoly.c.o"
+  "CMakeFiles/mc-mbedtls_static.dir/library/chachapoly.c.o.d"
+  "CMakeFiles/mc-mbedtls_static.dir/library/cipher.c.o"
+  "CMakeFiles/mc-mbedtls_static.dir/library/cipher.c.o.d"
+  "CMakeFiles/mc-mbedtls_static.dir/library/cipher_wrap.c.o"
+  "CMakeFiles/mc-mbedtls_static.dir/library/cipher_wrap.c.o.d"
+  "CMakeFiles/mc-mbedtls_static.dir/library/cmac.c.o"
+  "CMakeFiles/mc-mbedtls_static.dir/library/cmac.c.o.d"
+  "CMakeFiles/mc-mbedtls_static.dir/library/ctr_drbg.c.o"
+  "CMakeFiles/mc-mbedtls_static.dir/library/ctr_drbg.c.o.d"
+  "CMakeFiles/mc-mbedtls_static.dir/library/debug.c.o"
+  "CMakeFiles/mc-mbedtls_static.dir/library/debug.c.o.d"
+  "CMakeFiles/mc-mbedtls_static.dir/library/des.c.o"
+  "CMakeFiles/mc-mbedtls_static.dir/library/des.c.o.d"
+  "CMakeFiles/mc-mbedtls_static.dir/library/dhm.c.o"
+  "CMakeFiles/mc-mbedtls_static.dir/library/dhm.c.o.d"
+  "CMakeFiles/mc-mbedtls_static.dir/library/ecdh.c.o"
+  "CMakeFiles/mc-mbedtls_static.dir/library/ecdh.c.o.d"
+  "CMakeFiles/mc-mbedtls_static.dir/library/ecdsa.c.o"
+  "CMakeFiles/mc-mbedtls_static.dir/library/ecdsa.c.o.d"
+  "CMakeFiles/mc-mbedtls_static.dir/library/ecjpake.c.o"
+  "CMakeFiles/mc-mbedtls_static.dir/library/ecjpake.c.o.d"
+  "CMakeFiles/mc-mbedtls_static.dir/library/ecp.c.o"
+  "CMakeFiles/mc-mbedtls_static.dir/library/ecp.c.o.d"
+  "CMakeFiles/mc-mbedtls_static.dir/library/ecp_curves.c.o"
+  "CMakeFiles/mc-mbedtls_static.dir/library/ecp_curves.c.o.d"
+  "CMakeFiles/mc-mbedtls_static.dir/library/entropy.c.o"
+  "CMakeFiles/mc-mbedtls_static.dir/library/entropy.c.o.d"
+  "CMakeFiles/mc-mbedtls_static.dir/library/entropy_poll.c.o"
+  "CMakeFiles/mc-mbedtls_static.dir/library/entropy_poll.c.o.d"
+  "CMakeFiles/mc-mbedtls_static.dir/library/error.c.o"
+  "CMakeFiles/mc-mbedtls_static.dir/library/error.c.o.d"
+  "CMakeFiles/mc-mbedtls_static.dir/library/gcm.c.o"
+  "CMakeFiles/mc-mbedtls_static.dir/library/gcm.c.o.d"
+  "CMakeFiles/mc-mbedtls_static.dir/library/havege.c.o"
+  "CMakeFiles/mc-mbedtls_static.dir/library/havege.c.o.d"
+  "CMakeFiles/mc-mbedtls_static.dir/library/hkdf.c.o"
+  "CMakeFiles/mc-mbedtls_static.dir/library/hkdf.c.o.d"
+  "CMakeFiles/mc-mbedtls_static.dir/library/hmac_drbg.c.o"
+  "CMakeFiles/mc-mbedtls_static.dir/library/hmac_drbg.c.o.d"
+  "CMakeFiles/mc-mbedtls_static.dir/library/md.c.o"
+  "CMakeFiles/mc-mbedtls_static.dir/library/md.c.o.d"
+  "CMakeFiles/mc-mbedtls_static.dir/library/md2.c.o"
+  "CMakeFiles/mc-mbedtls_static.dir/library/md2.c.o.d"
+  "CMakeFiles/mc-mbedtls_static.dir/library/md4.c.o"
+  "CMakeFiles/mc-mbedtls_static.dir/library/md4.c.o.d"
+  "CMakeFiles/mc-mbedtls_static.dir/library/md5.c.o"
+  "CMakeFiles/mc-mbedtls_static.dir/library/md5.c.o.d"
+  "CMakeFiles/mc-mbedtls_static.dir/library/md_wrap.c.o"
+  "CMakeFiles/mc-mbedtls_static.dir/library/md_wrap.c.o.d"
+  "CMakeFiles/mc-mbedtls_static.dir/library/memory_buffer_alloc.c.o"
+  "CMakeFiles/mc-mbedtls_static.dir/library/memory_buffer_alloc.c.o.d"
+  "CMakeFiles/mc-mbedtls_static.dir/library/net_sockets.c.o"
+  "CMakeFiles/mc-mbedtls_static.dir/library/net_sockets.c.o.d"
+  "CMakeFiles/mc-mbedtls_static.dir/library/nist_kw.c.o"
+  "CMakeFiles/mc-mbedtls_static.dir/library/nist_kw.c.o.d"
+  "CMakeFiles/mc-mbedtls_static.dir/library/oid.c.o"
+  "CMakeFiles/mc-mbedtls_static.dir/library/oid.c.o.d"
+  "CMakeFiles/mc-mbedtls_static.dir/library/padlock.c.o"
+  "CMakeFiles/mc-mbedtls_static.dir/library/padlock.c.o.d"
+  "CMakeFiles/mc-mbedtls_static.dir/library/pem.c.o"
+  "CMakeFiles/mc-mbedtls_static.dir/library/pem.c.o.d"
+  "CMakeFiles/mc-mbedtls_static.dir/library/pk.c.o"
+  "CMakeFiles/mc-mbedtls_static.dir/library/pk.c.o.d"
+  "CMakeFiles/mc-mbedtls_static.dir/library/pk_wrap.c.o"
+  "CMakeFiles/mc-mbedtls_static.dir/library/pk_wrap.c.o.d"
+  "CMakeFiles/mc-mbedtls_static.dir/library/pkcs11.c.o"
+  "CMakeFiles/mc-mbedtls_static.dir/library/pkcs11.c.o.d"
+  "CMakeFiles/mc-mbedtls_static.dir/library/pkcs12.c.o"
+  "CMakeFiles/mc-mbedtls_static.dir/library/pkcs12.c.o.d"
+  "CMakeFiles/mc-mbedtls_static.dir/library/pkcs5.c.o"
+  "CMakeFiles/mc-mbedtls_static.dir/library/pkcs5.c.o.d"
+  "CMakeFiles/mc-mbedtls_static.dir/library/pkparse.c.o"
+  "CMakeFiles/mc-mbedtls_static.dir/library/pkparse.c.o.d"
+  "CMakeFiles/mc-mbedtls_static.dir/library/pkwrite.c.o"
+  "CMakeFiles/mc-mbedtls_static.dir/library/pkwrite.c.o.d"
+  "CMakeFiles/mc-mbedtls_static.dir/library/platform.c.o"
+  "CMakeFiles/mc-mbedtls_static.dir/library/platform.c.o.d"
+  "CMakeFiles/mc-mbedtls_static.dir/library/platform_util.c.o"
+  "CMakeFiles/mc-mbedtls_static.dir/library/platform_util.c.o.d"
+  "CMakeFiles/mc-mbedtls_static.dir/library/poly1305.c.o"
+  "CMakeFiles/mc-mbedtls_static.dir/library/poly1305.c.o.d"
+  "CMakeFiles/mc-mbedtls_static.dir/library/ripemd160.c.o"
+  "CMakeFiles/mc-mbedtls_static.dir/library/ripemd160.c.o.d"
+  "CMakeFiles/mc-mbedtls_static.dir/library/rsa.c.o"
+  "CMakeFiles/mc-mbedtls_static.dir/library/rsa.c.o.d"
+  "CMakeFiles/mc-mbedtls_static.dir/library/rsa_internal.c.o"
+  "CMakeFiles/mc-mbedtls_static.dir/library/rsa_internal.c.o.d"
+  "CMakeFiles/mc-mbedtls_static.dir/library/sha1.c.o"
+  "CMakeFiles/mc-mbedtls_static.dir/library/sha1.c.o.d"
+  "CMakeFiles/mc-mbedtls_static.dir/library/sha256.c.o"
+  "CMakeFiles/mc-mbedtls_static.dir/library/sha256.c.o.d"
+  "CMakeFiles/mc-mbedtls_static.dir/library/sha512.c.o"
+  "CMakeFiles/mc-mbedtls_static.dir/library/sha512.c.o.d"
+  "CMakeFiles/mc-mbedtls_static.dir/library/ssl_cache.c.o"
+  "CMakeFiles/mc-mbedtls_static.dir/library/ssl_cache.c.o.d"
+  "CMakeFiles/mc-mbedtls_static.dir/library/ssl_ciphersuites.c.o"
+  "CMakeFiles/mc-mbedtls_static.dir/library/ssl_ciphersuites.c.o.d"
+  "CMakeFiles/mc-mbedtls_static.dir/library/ssl_cli.c.o"
+  "CMakeFiles/mc-mbedtls_static.dir/library/ssl_cli.c.o.d"
+  "CMakeFiles/mc-mbedtls_static.dir/library/ssl_cookie.c.o"
+  "CMakeFiles/mc-mbedtls_static.dir/library/ssl_cookie.c.o.d"
+  "CMakeFiles/mc-mbedtls_static.dir/library/ssl_srv.c.o"
+  "CMakeFiles/mc-mbedtls_static.dir/library/ssl_srv.c.o.d"
+  "CMakeFiles/mc-mbedtls_static.dir/library/ssl_ticket.c.o"
+  "CMakeFiles/mc-mbedtls_static.dir/library/ssl_ticket.c.o.d"
+  "CMakeFiles/mc-mbedtls_static.dir/library/ssl_tls.c.o"
+  "CMakeFiles/mc-mbedtls_static.dir/library/ssl_tls.c.o.d"
+  "CMakeFiles/mc-mbedtls_static.dir/library/threading.c.o"
+  "CMakeFiles/mc-mbedtls_static.dir/library/threading.c.o.d"
+  "CMakeFiles/mc-mbedtls_static.dir/library/timing.c.o"
+  "CMakeFiles/mc-mbedtls_static.dir/library/timing.c.o.d"
+  "CMakeFiles/mc-mbedtls_static.dir/library/version.c.o"
+  "CMakeFiles/mc-mbedtls_static.dir/library/version.c.o.d"
+  "CMakeFiles/mc-mbedtls_static.dir/library/version_features.c.o"
+  "CMakeFiles/mc-mbedtls_static.dir/library/version_features.c.o.d"
+  "CMakeFiles/mc-mbedtls_static.dir/library/x509.c.o"
+  "CMakeFiles/mc-mbedtls_static.dir/library/x509.c.o.d"
+  "CMakeFiles/mc-mbedtls_static.dir/library/x509_create.c.o"
+  "CMakeFiles/mc-mbedtls_static.dir/library/x509_create.c.o.d"
+  "CMakeFiles/mc-mbedtls_static.dir/library/x509_crl.c.o"
+  "CMakeFiles/mc-mbedtls_static.dir/library/x509_crl.c.o.d"
+  "CMakeFiles/mc-mbedtls_static.dir/library/x509_crt.c.o"
+  "CMakeFiles/mc-mbedtls_static.dir/library/x509_crt.c.o.d"
+  "CMakeFiles/mc-mbedtls_static.dir/library/x509_csr.c.o"
+  "CMakeFiles/mc-mbedtls_static.dir/library/x509_csr.c.o.d"
+  "CMakeFiles/mc-mbedtls_static.dir/library/x509write_crt.c.o"
+  "CMakeFiles/mc-mbedtls_static.dir/library/x509write_crt.c.o.d"
+  "CMakeFiles/mc-mbedtls_static.dir/library/x509write_csr.c.o"
+  "CMakeFiles/mc-mbedtls_static.dir/library/x509write_csr.c.o.d"
+  "CMakeFiles/mc-mbedtls_static.dir/library/xtea.c.o"
+  "CMakeFiles/mc-mbedtls_static.dir/library/xtea.c.o.d"
+  "CMakeFiles/mc-mbedtls_static.dir/wrapper/entropy_hardware_alt.c.o"
+  "CMakeFiles/mc-mbedtls_static.dir/wrapper/entropy_hardware_alt.c.o.d"
+  "CMakeFiles/mc-mbedtls_static.dir/wrapper/net_sockets_alt.c.o"
+  "CMakeFiles/mc-mbedtls_static.dir/wrapper/net_sockets_alt.c.o.d"
+  "CMakeFiles/mc-mbedtls_static.dir/wrapper/timing_alt.c.o"
+  "CMakeFiles/mc-mbedtls_static.dir/wrapper/timing_alt.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/mc-mbedtls_static.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,17 @@
+file(REMOVE_RECURSE
+  "../lib/libmc-common.a"
+  "../lib/libmc-common.pdb"
+  "CMakeFiles/mc-common_static.dir/mqtt_list.c.o"
+  "CMakeFiles/mc-common_static.dir/mqtt_list.c.o.d"
+  "CMakeFiles/mc-common_static.dir/mqtt_ring.c.o"
+  "CMakeFiles/mc-common_static.dir/mqtt_ring.c.o.d"
+  "CMakeFiles/mc-common_static.dir/mqtt_wheel.c.o"
+  "CMakeFiles/mc-common_static.dir/mqtt_wheel.c.o.d"
+  "CMakeFiles/mc-common_static.dir/random.c.o"
+  "CMakeFiles/mc-common_static.dir/random.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/mc-common_static.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
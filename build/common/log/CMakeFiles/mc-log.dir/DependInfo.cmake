@@ -0,0 +1,28 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/common/log/arch/linux/arch.c" "common/log/CMakeFiles/mc-log.dir/arch/linux/arch.c.o" "gcc" "common/log/CMakeFiles/mc-log.dir/arch/linux/arch.c.o.d"
+  "/root/repo/common/log/fifo.c" "common/log/CMakeFiles/mc-log.dir/fifo.c.o" "gcc" "common/log/CMakeFiles/mc-log.dir/fifo.c.o.d"
+  "/root/repo/common/log/format.c" "common/log/CMakeFiles/mc-log.dir/format.c.o" "gcc" "common/log/CMakeFiles/mc-log.dir/format.c.o.d"
+  "/root/repo/common/log/salof.c" "common/log/CMakeFiles/mc-log.dir/salof.c.o" "gcc" "common/log/CMakeFiles/mc-log.dir/salof.c.o.d"
+  )
+
+# Pairs of files generated by the same build rule.
+set(CMAKE_MULTIPLE_OUTPUT_PAIRS
+  "/root/repo/build/lib/libmc-log.so" "/root/repo/build/lib/libmc-log.so.1.2.0"
+  )
+
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,18 @@
+file(REMOVE_RECURSE
+  "../../lib/libmc-log.pdb"
+  "../../lib/libmc-log.so"
+  "../../lib/libmc-log.so.1.2.0"
+  "CMakeFiles/mc-log.dir/arch/linux/arch.c.o"
+  "CMakeFiles/mc-log.dir/arch/linux/arch.c.o.d"
+  "CMakeFiles/mc-log.dir/fifo.c.o"
+  "CMakeFiles/mc-log.dir/fifo.c.o.d"
+  "CMakeFiles/mc-log.dir/format.c.o"
+  "CMakeFiles/mc-log.dir/format.c.o.d"
+  "CMakeFiles/mc-log.dir/salof.c.o"
+  "CMakeFiles/mc-log.dir/salof.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/mc-log.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
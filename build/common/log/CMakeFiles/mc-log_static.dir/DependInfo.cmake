@@ -0,0 +1,22 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/common/log/arch/linux/arch.c" "common/log/CMakeFiles/mc-log_static.dir/arch/linux/arch.c.o" "gcc" "common/log/CMakeFiles/mc-log_static.dir/arch/linux/arch.c.o.d"
+  "/root/repo/common/log/fifo.c" "common/log/CMakeFiles/mc-log_static.dir/fifo.c.o" "gcc" "common/log/CMakeFiles/mc-log_static.dir/fifo.c.o.d"
+  "/root/repo/common/log/format.c" "common/log/CMakeFiles/mc-log_static.dir/format.c.o" "gcc" "common/log/CMakeFiles/mc-log_static.dir/format.c.o.d"
+  "/root/repo/common/log/salof.c" "common/log/CMakeFiles/mc-log_static.dir/salof.c.o" "gcc" "common/log/CMakeFiles/mc-log_static.dir/salof.c.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,26 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/example/ali/ali.c" "example/ali/CMakeFiles/ali_example.dir/ali.c.o" "gcc" "example/ali/CMakeFiles/ali_example.dir/ali.c.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/build/mqttclient/CMakeFiles/mc-mqttclient.dir/DependInfo.cmake"
+  "/root/repo/build/mqtt/CMakeFiles/mc-mqtt.dir/DependInfo.cmake"
+  "/root/repo/build/network/CMakeFiles/mc-network.dir/DependInfo.cmake"
+  "/root/repo/build/network/mbedtls/CMakeFiles/mc-mbedtls.dir/DependInfo.cmake"
+  "/root/repo/build/platform/CMakeFiles/mc-platform.dir/DependInfo.cmake"
+  "/root/repo/build/common/CMakeFiles/mc-common.dir/DependInfo.cmake"
+  "/root/repo/build/common/log/CMakeFiles/mc-log.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/ali_example"
+  "../../bin/ali_example.pdb"
+  "CMakeFiles/ali_example.dir/ali.c.o"
+  "CMakeFiles/ali_example.dir/ali.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/ali_example.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/baidu_example"
+  "../../bin/baidu_example.pdb"
+  "CMakeFiles/baidu_example.dir/baidu.c.o"
+  "CMakeFiles/baidu_example.dir/baidu.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/baidu_example.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
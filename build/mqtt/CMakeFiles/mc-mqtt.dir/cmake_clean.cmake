@@ -0,0 +1,30 @@
+file(REMOVE_RECURSE
+  "../lib/libmc-mqtt.pdb"
+  "../lib/libmc-mqtt.so"
+  "../lib/libmc-mqtt.so.1.2.0"
+  "CMakeFiles/mc-mqtt.dir/MQTTConnectClient.c.o"
+  "CMakeFiles/mc-mqtt.dir/MQTTConnectClient.c.o.d"
+  "CMakeFiles/mc-mqtt.dir/MQTTConnectServer.c.o"
+  "CMakeFiles/mc-mqtt.dir/MQTTConnectServer.c.o.d"
+  "CMakeFiles/mc-mqtt.dir/MQTTDeserializePublish.c.o"
+  "CMakeFiles/mc-mqtt.dir/MQTTDeserializePublish.c.o.d"
+  "CMakeFiles/mc-mqtt.dir/MQTTFormat.c.o"
+  "CMakeFiles/mc-mqtt.dir/MQTTFormat.c.o.d"
+  "CMakeFiles/mc-mqtt.dir/MQTTPacket.c.o"
+  "CMakeFiles/mc-mqtt.dir/MQTTPacket.c.o.d"
+  "CMakeFiles/mc-mqtt.dir/MQTTSerializePublish.c.o"
+  "CMakeFiles/mc-mqtt.dir/MQTTSerializePublish.c.o.d"
+  "CMakeFiles/mc-mqtt.dir/MQTTSubscribeClient.c.o"
+  "CMakeFiles/mc-mqtt.dir/MQTTSubscribeClient.c.o.d"
+  "CMakeFiles/mc-mqtt.dir/MQTTSubscribeServer.c.o"
+  "CMakeFiles/mc-mqtt.dir/MQTTSubscribeServer.c.o.d"
+  "CMakeFiles/mc-mqtt.dir/MQTTUnsubscribeClient.c.o"
+  "CMakeFiles/mc-mqtt.dir/MQTTUnsubscribeClient.c.o.d"
+  "CMakeFiles/mc-mqtt.dir/MQTTUnsubscribeServer.c.o"
+  "CMakeFiles/mc-mqtt.dir/MQTTUnsubscribeServer.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/mc-mqtt.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
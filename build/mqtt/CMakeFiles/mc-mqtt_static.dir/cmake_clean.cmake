@@ -0,0 +1,29 @@
+file(REMOVE_RECURSE
+  "../lib/libmc-mqtt.a"
+  "../lib/libmc-mqtt.pdb"
+  "CMakeFiles/mc-mqtt_static.dir/MQTTConnectClient.c.o"
+  "CMakeFiles/mc-mqtt_static.dir/MQTTConnectClient.c.o.d"
+  "CMakeFiles/mc-mqtt_static.dir/MQTTConnectServer.c.o"
+  "CMakeFiles/mc-mqtt_static.dir/MQTTConnectServer.c.o.d"
+  "CMakeFiles/mc-mqtt_static.dir/MQTTDeserializePublish.c.o"
+  "CMakeFiles/mc-mqtt_static.dir/MQTTDeserializePublish.c.o.d"
+  "CMakeFiles/mc-mqtt_static.dir/MQTTFormat.c.o"
+  "CMakeFiles/mc-mqtt_static.dir/MQTTFormat.c.o.d"
+  "CMakeFiles/mc-mqtt_static.dir/MQTTPacket.c.o"
+  "CMakeFiles/mc-mqtt_static.dir/MQTTPacket.c.o.d"
+  "CMakeFiles/mc-mqtt_static.dir/MQTTSerializePublish.c.o"
+  "CMakeFiles/mc-mqtt_static.dir/MQTTSerializePublish.c.o.d"
+  "CMakeFiles/mc-mqtt_static.dir/MQTTSubscribeClient.c.o"
+  "CMakeFiles/mc-mqtt_static.dir/MQTTSubscribeClient.c.o.d"
+  "CMakeFiles/mc-mqtt_static.dir/MQTTSubscribeServer.c.o"
+  "CMakeFiles/mc-mqtt_static.dir/MQTTSubscribeServer.c.o.d"
+  "CMakeFiles/mc-mqtt_static.dir/MQTTUnsubscribeClient.c.o"
+  "CMakeFiles/mc-mqtt_static.dir/MQTTUnsubscribeClient.c.o.d"
+  "CMakeFiles/mc-mqtt_static.dir/MQTTUnsubscribeServer.c.o"
+  "CMakeFiles/mc-mqtt_static.dir/MQTTUnsubscribeServer.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/mc-mqtt_static.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
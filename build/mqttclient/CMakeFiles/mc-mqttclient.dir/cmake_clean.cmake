@@ -0,0 +1,20 @@
+file(REMOVE_RECURSE
+  "../lib/libmc-mqttclient.pdb"
+  "../lib/libmc-mqttclient.so"
+  "../lib/libmc-mqttclient.so.1.2.0"
+  "CMakeFiles/mc-mqttclient.dir/mqtt_group.c.o"
+  "CMakeFiles/mc-mqttclient.dir/mqtt_group.c.o.d"
+  "CMakeFiles/mc-mqttclient.dir/mqtt_pool.c.o"
+  "CMakeFiles/mc-mqttclient.dir/mqtt_pool.c.o.d"
+  "CMakeFiles/mc-mqttclient.dir/mqtt_reactor.c.o"
+  "CMakeFiles/mc-mqttclient.dir/mqtt_reactor.c.o.d"
+  "CMakeFiles/mc-mqttclient.dir/mqtt_topic_tree.c.o"
+  "CMakeFiles/mc-mqttclient.dir/mqtt_topic_tree.c.o.d"
+  "CMakeFiles/mc-mqttclient.dir/mqttclient.c.o"
+  "CMakeFiles/mc-mqttclient.dir/mqttclient.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/mc-mqttclient.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
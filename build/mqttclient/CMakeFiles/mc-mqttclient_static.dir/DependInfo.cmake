@@ -0,0 +1,23 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/mqttclient/mqtt_group.c" "mqttclient/CMakeFiles/mc-mqttclient_static.dir/mqtt_group.c.o" "gcc" "mqttclient/CMakeFiles/mc-mqttclient_static.dir/mqtt_group.c.o.d"
+  "/root/repo/mqttclient/mqtt_pool.c" "mqttclient/CMakeFiles/mc-mqttclient_static.dir/mqtt_pool.c.o" "gcc" "mqttclient/CMakeFiles/mc-mqttclient_static.dir/mqtt_pool.c.o.d"
+  "/root/repo/mqttclient/mqtt_reactor.c" "mqttclient/CMakeFiles/mc-mqttclient_static.dir/mqtt_reactor.c.o" "gcc" "mqttclient/CMakeFiles/mc-mqttclient_static.dir/mqtt_reactor.c.o.d"
+  "/root/repo/mqttclient/mqtt_topic_tree.c" "mqttclient/CMakeFiles/mc-mqttclient_static.dir/mqtt_topic_tree.c.o" "gcc" "mqttclient/CMakeFiles/mc-mqttclient_static.dir/mqtt_topic_tree.c.o.d"
+  "/root/repo/mqttclient/mqttclient.c" "mqttclient/CMakeFiles/mc-mqttclient_static.dir/mqttclient.c.o" "gcc" "mqttclient/CMakeFiles/mc-mqttclient_static.dir/mqttclient.c.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
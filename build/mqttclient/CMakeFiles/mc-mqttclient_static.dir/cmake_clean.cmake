@@ -0,0 +1,19 @@
+file(REMOVE_RECURSE
+  "../lib/libmc-mqttclient.a"
+  "../lib/libmc-mqttclient.pdb"
+  "CMakeFiles/mc-mqttclient_static.dir/mqtt_group.c.o"
+  "CMakeFiles/mc-mqttclient_static.dir/mqtt_group.c.o.d"
+  "CMakeFiles/mc-mqttclient_static.dir/mqtt_pool.c.o"
+  "CMakeFiles/mc-mqttclient_static.dir/mqtt_pool.c.o.d"
+  "CMakeFiles/mc-mqttclient_static.dir/mqtt_reactor.c.o"
+  "CMakeFiles/mc-mqttclient_static.dir/mqtt_reactor.c.o.d"
+  "CMakeFiles/mc-mqttclient_static.dir/mqtt_topic_tree.c.o"
+  "CMakeFiles/mc-mqttclient_static.dir/mqtt_topic_tree.c.o.d"
+  "CMakeFiles/mc-mqttclient_static.dir/mqttclient.c.o"
+  "CMakeFiles/mc-mqttclient_static.dir/mqttclient.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/mc-mqttclient_static.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
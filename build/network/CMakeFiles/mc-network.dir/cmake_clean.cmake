@@ -0,0 +1,16 @@
+file(REMOVE_RECURSE
+  "../lib/libmc-network.pdb"
+  "../lib/libmc-network.so"
+  "../lib/libmc-network.so.1.2.0"
+  "CMakeFiles/mc-network.dir/nettype_tcp.c.o"
+  "CMakeFiles/mc-network.dir/nettype_tcp.c.o.d"
+  "CMakeFiles/mc-network.dir/nettype_tls.c.o"
+  "CMakeFiles/mc-network.dir/nettype_tls.c.o.d"
+  "CMakeFiles/mc-network.dir/network.c.o"
+  "CMakeFiles/mc-network.dir/network.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/mc-network.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,21 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/network/nettype_tcp.c" "network/CMakeFiles/mc-network_static.dir/nettype_tcp.c.o" "gcc" "network/CMakeFiles/mc-network_static.dir/nettype_tcp.c.o.d"
+  "/root/repo/network/nettype_tls.c" "network/CMakeFiles/mc-network_static.dir/nettype_tls.c.o" "gcc" "network/CMakeFiles/mc-network_static.dir/nettype_tls.c.o.d"
+  "/root/repo/network/network.c" "network/CMakeFiles/mc-network_static.dir/network.c.o" "gcc" "network/CMakeFiles/mc-network_static.dir/network.c.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
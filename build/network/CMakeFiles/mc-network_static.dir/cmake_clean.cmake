@@ -0,0 +1,15 @@
+file(REMOVE_RECURSE
+  "../lib/libmc-network.a"
+  "../lib/libmc-network.pdb"
+  "CMakeFiles/mc-network_static.dir/nettype_tcp.c.o"
+  "CMakeFiles/mc-network_static.dir/nettype_tcp.c.o.d"
+  "CMakeFiles/mc-network_static.dir/nettype_tls.c.o"
+  "CMakeFiles/mc-network_static.dir/nettype_tls.c.o.d"
+  "CMakeFiles/mc-network_static.dir/network.c.o"
+  "CMakeFiles/mc-network_static.dir/network.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/mc-network_static.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
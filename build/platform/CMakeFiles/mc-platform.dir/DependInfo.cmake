@@ -0,0 +1,32 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/platform/linux/platform_event.c" "platform/CMakeFiles/mc-platform.dir/linux/platform_event.c.o" "gcc" "platform/CMakeFiles/mc-platform.dir/linux/platform_event.c.o.d"
+  "/root/repo/platform/linux/platform_memory.c" "platform/CMakeFiles/mc-platform.dir/linux/platform_memory.c.o" "gcc" "platform/CMakeFiles/mc-platform.dir/linux/platform_memory.c.o.d"
+  "/root/repo/platform/linux/platform_mutex.c" "platform/CMakeFiles/mc-platform.dir/linux/platform_mutex.c.o" "gcc" "platform/CMakeFiles/mc-platform.dir/linux/platform_mutex.c.o.d"
+  "/root/repo/platform/linux/platform_net_socket.c" "platform/CMakeFiles/mc-platform.dir/linux/platform_net_socket.c.o" "gcc" "platform/CMakeFiles/mc-platform.dir/linux/platform_net_socket.c.o.d"
+  "/root/repo/platform/linux/platform_thread.c" "platform/CMakeFiles/mc-platform.dir/linux/platform_thread.c.o" "gcc" "platform/CMakeFiles/mc-platform.dir/linux/platform_thread.c.o.d"
+  "/root/repo/platform/linux/platform_timer.c" "platform/CMakeFiles/mc-platform.dir/linux/platform_timer.c.o" "gcc" "platform/CMakeFiles/mc-platform.dir/linux/platform_timer.c.o.d"
+  )
+
+# Pairs of files generated by the same build rule.
+set(CMAKE_MULTIPLE_OUTPUT_PAIRS
+  "/root/repo/build/lib/libmc-platform.so" "/root/repo/build/lib/libmc-platform.so.1.2.0"
+  )
+
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/build/common/CMakeFiles/mc-common.dir/DependInfo.cmake"
+  "/root/repo/build/common/log/CMakeFiles/mc-log.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,21 @@
+file(REMOVE_RECURSE
+  "../lib/libmc-platform.a"
+  "../lib/libmc-platform.pdb"
+  "CMakeFiles/mc-platform_static.dir/linux/platform_event.c.o"
+  "CMakeFiles/mc-platform_static.dir/linux/platform_event.c.o.d"
+  "CMakeFiles/mc-platform_static.dir/linux/platform_memory.c.o"
+  "CMakeFiles/mc-platform_static.dir/linux/platform_memory.c.o.d"
+  "CMakeFiles/mc-platform_static.dir/linux/platform_mutex.c.o"
+  "CMakeFiles/mc-platform_static.dir/linux/platform_mutex.c.o.d"
+  "CMakeFiles/mc-platform_static.dir/linux/platform_net_socket.c.o"
+  "CMakeFiles/mc-platform_static.dir/linux/platform_net_socket.c.o.d"
+  "CMakeFiles/mc-platform_static.dir/linux/platform_thread.c.o"
+  "CMakeFiles/mc-platform_static.dir/linux/platform_thread.c.o.d"
+  "CMakeFiles/mc-platform_static.dir/linux/platform_timer.c.o"
+  "CMakeFiles/mc-platform_static.dir/linux/platform_timer.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/mc-platform_static.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
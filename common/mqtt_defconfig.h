@@ -36,6 +36,10 @@
     #define     MQTT_ACK_HANDLER_NUM_MAX            64
 #endif // !MQTT_ACK_HANDLER_NUM_MAX
 
+#ifndef MQTT_INFLIGHT_TIMEOUT
+    #define     MQTT_INFLIGHT_TIMEOUT               0       // unit: millisecond, 0 is not waiting
+#endif // !MQTT_INFLIGHT_TIMEOUT
+
 #ifndef MQTT_DEFAULT_BUF_SIZE
     #define     MQTT_DEFAULT_BUF_SIZE               1024
 #endif // !MQTT_DEFAULT_BUF_SIZE
@@ -64,6 +68,26 @@
     #define     MQTT_RECONNECT_DEFAULT_DURATION     1000
 #endif // !MQTT_RECONNECT_DEFAULT_DURATION
 
+#ifndef MQTT_RECONNECT_MAX_DURATION
+    #define     MQTT_RECONNECT_MAX_DURATION         60000       // upper bound of the reconnect backoff, unit: ms
+#endif // !MQTT_RECONNECT_MAX_DURATION
+
+#ifndef MQTT_RECONNECT_JITTER
+    #define     MQTT_RECONNECT_JITTER               MQTT_BACKOFF_JITTER_FULL
+#endif // !MQTT_RECONNECT_JITTER
+
+#ifndef MQTT_RECONNECT_BREAKER_THRESHOLD
+    #define     MQTT_RECONNECT_BREAKER_THRESHOLD    0           // consecutive failures that open the breaker, 0: disabled
+#endif // !MQTT_RECONNECT_BREAKER_THRESHOLD
+
+#ifndef MQTT_RECONNECT_BREAKER_COOLDOWN
+    #define     MQTT_RECONNECT_BREAKER_COOLDOWN     300000      // unit: ms
+#endif // !MQTT_RECONNECT_BREAKER_COOLDOWN
+
+#ifndef MQTT_ENDPOINT_RETRY_INTERVAL
+    #define     MQTT_ENDPOINT_RETRY_INTERVAL        5000        // pause of a failed endpoint, doubled per failure up to 16x, unit: ms
+#endif // !MQTT_ENDPOINT_RETRY_INTERVAL
+
 #ifndef MQTT_THREAD_STACK_SIZE
     #define     MQTT_THREAD_STACK_SIZE              4096
 #endif // !MQTT_THREAD_STACK_SIZE
@@ -76,6 +100,86 @@
     #define     MQTT_THREAD_TICK                    50
 #endif // !MQTT_THREAD_TICK
 
+#ifndef MQTT_ACK_HASH_SIZE
+    #define     MQTT_ACK_HASH_SIZE                  64      // must be a power of 2
+#endif // !MQTT_ACK_HASH_SIZE
+
+#ifndef MQTT_ACK_WHEEL_SLOTS
+    #define     MQTT_ACK_WHEEL_SLOTS                64      // must be a power of 2
+#endif // !MQTT_ACK_WHEEL_SLOTS
+
+#ifndef MQTT_ACK_WHEEL_TICK
+    #define     MQTT_ACK_WHEEL_TICK                 100     // unit: millisecond
+#endif // !MQTT_ACK_WHEEL_TICK
+
+#ifndef MQTT_SUBSCRIBE_BATCH_MAX
+    #define     MQTT_SUBSCRIBE_BATCH_MAX            64      // topic filters per SUBSCRIBE packet
+#endif // !MQTT_SUBSCRIBE_BATCH_MAX
+
+#ifndef MQTT_ACK_RTO_MIN
+    #define     MQTT_ACK_RTO_MIN                    1000    // unit: millisecond
+#endif // !MQTT_ACK_RTO_MIN
+
+#ifndef MQTT_ACK_RTO_MAX
+    #define     MQTT_ACK_RTO_MAX                    60000   // unit: millisecond
+#endif // !MQTT_ACK_RTO_MAX
+
+
+#ifdef MQTT_USING_REACTOR
+
+#ifndef MQTT_REACTOR_EVENT_MAX
+    #define     MQTT_REACTOR_EVENT_MAX              64
+#endif // !MQTT_REACTOR_EVENT_MAX
+
+#ifndef MQTT_REACTOR_TICK
+    #define     MQTT_REACTOR_TICK                   100     // unit: millisecond
+#endif // !MQTT_REACTOR_TICK
+
+#ifndef MQTT_REACTOR_WORKER_NUM
+    #define     MQTT_REACTOR_WORKER_NUM             4       // reconnect threads per event loop
+#endif // !MQTT_REACTOR_WORKER_NUM
+
+#endif /* MQTT_USING_REACTOR */
+
+#ifdef MQTT_USING_PUBLISH_ASYNC
+
+#ifndef MQTT_PUBLISH_QUEUE_MAX
+    #define     MQTT_PUBLISH_QUEUE_MAX              32
+#endif // !MQTT_PUBLISH_QUEUE_MAX
+
+#ifndef MQTT_PUBLISH_QUEUE_TICK
+    #define     MQTT_PUBLISH_QUEUE_TICK             10      // unit: millisecond
+#endif // !MQTT_PUBLISH_QUEUE_TICK
+
+#endif /* MQTT_USING_PUBLISH_ASYNC */
+
+#ifdef MQTT_USING_WRITER_THREAD
+
+#ifndef MQTT_WRITER_RING_SIZE
+    #define     MQTT_WRITER_RING_SIZE               256     // must be a power of 2
+#endif // !MQTT_WRITER_RING_SIZE
+
+#ifndef MQTT_WRITER_THREAD_STACK_SIZE
+    #define     MQTT_WRITER_THREAD_STACK_SIZE       MQTT_THREAD_STACK_SIZE
+#endif // !MQTT_WRITER_THREAD_STACK_SIZE
+
+#endif /* MQTT_USING_WRITER_THREAD */
+
+#ifdef MQTT_USING_MEMORY_POOL
+
+#ifndef MQTT_POOL_BLOCK_MIN
+    #define     MQTT_POOL_BLOCK_MIN                 64      // must be a power of 2
+#endif // !MQTT_POOL_BLOCK_MIN
+
+#ifndef MQTT_POOL_CLASS_NUM
+    #define     MQTT_POOL_CLASS_NUM                 7       // block sizes: 64, 128, ... 4096
+#endif // !MQTT_POOL_CLASS_NUM
+
+#ifndef MQTT_POOL_SLAB_SIZE
+    #define     MQTT_POOL_SLAB_SIZE                 4096
+#endif // !MQTT_POOL_SLAB_SIZE
+
+#endif /* MQTT_USING_MEMORY_POOL */
 
 #ifndef MQTT_NETWORK_TYPE_NO_TLS
 
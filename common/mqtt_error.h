@@ -13,6 +13,8 @@ extern "C" {
 #endif
 
 typedef enum mqtt_error {
+    MQTT_NOT_SUPPORT_ERROR                                  = -0x001E,      /* the operation is not supported by the network or platform */
+    MQTT_PUBLISH_QUEUE_FULL_ERROR                           = -0x001D,      /* mqtt asynchronous publish queue is full */
     MQTT_SSL_CERT_ERROR                                     = -0x001C,      /* cetr parse failed */
     MQTT_SOCKET_FAILED_ERROR                                = -0x001B,      /* socket fd failed */
     MQTT_SOCKET_UNKNOWN_HOST_ERROR                          = -0x001A,      /* socket unknown host ip or domain */ 
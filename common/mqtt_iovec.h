@@ -0,0 +1,31 @@
+/*
+ * @Author: jiejie
+ * @Github: https://github.com/jiejieTop
+ * @Date: 2026-10-16 14:05:37
+ * @LastEditTime: 2026-10-16 14:05:37
+ * @Description: MQTT 分散写数据段定义
+ *               网络层与平台层共用，用于把多个不连续的缓冲区（如报头 + 负载）一次发送出去。
+ *               代码属于 jiejie，请根据许可证保留作者信息和源代码。
+ */
+#ifndef _MQTT_IOVEC_H_
+#define _MQTT_IOVEC_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define     MQTT_IOV_MAX        8       /* 一次分散写最多支持的数据段数 */
+
+/**
+ * @brief 分散写数据段
+ */
+typedef struct mqtt_iovec {
+    unsigned char       *buf;           ///< 数据段起始地址
+    int                 len;            ///< 数据段长度（字节）
+} mqtt_iovec_t;
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _MQTT_IOVEC_H_ */
@@ -0,0 +1,123 @@
+/*
+ * @Author: jiejie
+ * @Github: https://github.com/jiejieTop
+ * @Date: 2026-10-16 16:20:44
+ * @LastEditTime: 2026-10-16 16:20:44
+ * @Description: MQTT 无锁环形队列实现文件
+ *               基于 Dmitry Vyukov 的有界队列：槽位序号等于写位置时可写，
+ *               等于写位置 + 1 时可读。出队只允许一个消费者调用。
+ *               代码属于 jiejie，请根据许可证保留作者信息和源代码。
+ */
+#include "mqtt_ring.h"
+
+#ifdef MQTT_USING_WRITER_THREAD
+
+#include <stddef.h>
+#include "mqtt_error.h"
+
+/**
+ * @brief 初始化环形队列
+ * 
+ * @param[in] ring   环形队列
+ * @param[in] cells  槽位数组，由调用者分配
+ * @param[in] size   槽位个数，必须是 2 的幂
+ * @return 
+ *   - MQTT_SUCCESS_ERROR: 初始化成功
+ *   - MQTT_NULL_VALUE_ERROR: 参数错误
+ */
+int mqtt_ring_init(mqtt_ring_t *ring, mqtt_ring_cell_t *cells, uint32_t size)
+{
+    uint32_t i;
+
+    if ((NULL == ring) || (NULL == cells) || (0 == size) || (0 != (size & (size - 1))))
+        RETURN_ERROR(MQTT_NULL_VALUE_ERROR);
+
+    for (i = 0; i < size; i++) {
+        cells[i].sequence = i;
+        cells[i].data = NULL;
+    }
+
+    ring->cells = cells;
+    ring->mask = size - 1;
+    ring->head = 0;
+    ring->tail = 0;
+
+    RETURN_ERROR(MQTT_SUCCESS_ERROR);
+}
+
+/**
+ * @brief 入队，可由多个线程同时调用
+ * 
+ * @param[in] ring  环形队列
+ * @param[in] data  要保存的指针
+ * @return 
+ *   - MQTT_SUCCESS_ERROR: 入队成功
+ *   - MQTT_FAILED_ERROR: 队列已满
+ */
+int mqtt_ring_push(mqtt_ring_t *ring, void *data)
+{
+    mqtt_ring_cell_t *cell;
+    uint32_t pos, seq;
+    int32_t diff;
+
+    pos = __atomic_load_n(&ring->head, __ATOMIC_RELAXED);
+    for (;;) {
+        cell = &ring->cells[pos & ring->mask];
+        seq = __atomic_load_n(&cell->sequence, __ATOMIC_ACQUIRE);
+        diff = (int32_t)(seq - pos);
+
+        if (0 == diff) {
+            /* 槽位可写，抢占写位置；失败时 pos 被更新为最新的写位置 */
+            if (__atomic_compare_exchange_n(&ring->head, &pos, pos + 1, 1, __ATOMIC_RELAXED, __ATOMIC_RELAXED))
+                break;
+        } else if (diff < 0) {
+            /* 消费者还没有读走一圈之前的数据 */
+            return MQTT_FAILED_ERROR;
+        } else {
+            pos = __atomic_load_n(&ring->head, __ATOMIC_RELAXED);
+        }
+    }
+
+    cell->data = data;
+    __atomic_store_n(&cell->sequence, pos + 1, __ATOMIC_RELEASE);
+
+    return MQTT_SUCCESS_ERROR;
+}
+
+/**
+ * @brief 出队，同一时刻只能由一个线程调用
+ * 
+ * @param[in] ring  环形队列
+ * @return 队首的指针，队列为空（或队首槽位还未写完）时返回 NULL
+ */
+void *mqtt_ring_pop(mqtt_ring_t *ring)
+{
+    void *data;
+    uint32_t pos = ring->tail;
+    mqtt_ring_cell_t *cell = &ring->cells[pos & ring->mask];
+
+    if (__atomic_load_n(&cell->sequence, __ATOMIC_ACQUIRE) != (pos + 1))
+        return NULL;
+
+    data = cell->data;
+    ring->tail = pos + 1;
+    /* 槽位在一圈之后可以被再次写入 */
+    __atomic_store_n(&cell->sequence, pos + ring->mask + 1, __ATOMIC_RELEASE);
+
+    return data;
+}
+
+/**
+ * @brief 判断队列是否为空，只应由消费者调用
+ * 
+ * @param[in] ring  环形队列
+ * @return 1 表示为空，0 表示不为空
+ */
+int mqtt_ring_is_empty(mqtt_ring_t *ring)
+{
+    mqtt_ring_cell_t *cell = &ring->cells[ring->tail & ring->mask];
+
+    return (__atomic_load_n(&cell->sequence, __ATOMIC_SEQ_CST) != (ring->tail + 1));
+}
+
+#endif /* MQTT_USING_WRITER_THREAD */
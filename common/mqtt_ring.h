@@ -0,0 +1,56 @@
+/*
+ * @Author: jiejie
+ * @Github: https://github.com/jiejieTop
+ * @Date: 2026-10-16 16:20:44
+ * @LastEditTime: 2026-10-16 16:20:44
+ * @Description: MQTT 无锁环形队列头文件
+ *               有界的多生产者单消费者（MPSC）指针队列，每个槽位带序号，
+ *               生产者通过原子操作抢占写位置，无需互斥锁。
+ *               依赖 GCC/Clang 的 __atomic 内建函数。
+ *               代码属于 jiejie，请根据许可证保留作者信息和源代码。
+ */
+#ifndef _MQTT_RING_H_
+#define _MQTT_RING_H_
+
+#include "mqtt_defconfig.h"
+
+#ifdef MQTT_USING_WRITER_THREAD
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief 环形队列槽位
+ */
+typedef struct mqtt_ring_cell {
+    uint32_t            sequence;       ///< 槽位序号，用于判断槽位可写还是可读
+    void                *data;          ///< 槽位中保存的指针
+} mqtt_ring_cell_t;
+
+/**
+ * @brief 环形队列
+ * 
+ * @note 槽位数组由调用者分配，槽位个数必须是 2 的幂
+ */
+typedef struct mqtt_ring {
+    mqtt_ring_cell_t    *cells;         ///< 槽位数组
+    uint32_t            mask;           ///< 槽位个数 - 1
+    uint32_t            head;           ///< 下一个写位置，多个生产者竞争
+    uint32_t            tail;           ///< 下一个读位置，只由消费者访问
+} mqtt_ring_t;
+
+int mqtt_ring_init(mqtt_ring_t *ring, mqtt_ring_cell_t *cells, uint32_t size);
+int mqtt_ring_push(mqtt_ring_t *ring, void *data);
+void *mqtt_ring_pop(mqtt_ring_t *ring);
+int mqtt_ring_is_empty(mqtt_ring_t *ring);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* MQTT_USING_WRITER_THREAD */
+
+#endif /* _MQTT_RING_H_ */
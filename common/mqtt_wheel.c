@@ -0,0 +1,116 @@
+/*
+ * @Author: jiejie
+ * @Github: https://github.com/jiejieTop
+ * @Date: 2026-10-16 23:40:12
+ * @LastEditTime: 2026-10-16 23:40:12
+ * @Description: MQTT 哈希时间轮实现文件
+ *               时间以毫秒计，比较时按有符号差值处理，允许计数回绕。
+ *               时间轮本身不加锁，由调用者保证互斥。
+ *               代码属于 jiejie，请根据许可证保留作者信息和源代码。
+ */
+#include <stddef.h>
+#include "mqtt_wheel.h"
+#include "mqtt_error.h"
+
+/**
+ * @brief 初始化时间轮
+ * 
+ * @param[in] wheel  时间轮
+ * @param[in] slots  槽位数组，由调用者分配
+ * @param[in] size   槽位个数，必须是 2 的幂
+ * @param[in] tick   每个槽位的时间跨度（毫秒）
+ * @param[in] now    当前时间（毫秒）
+ * @return 
+ *   - MQTT_SUCCESS_ERROR: 初始化成功
+ *   - MQTT_NULL_VALUE_ERROR: 参数错误
+ */
+int mqtt_wheel_init(mqtt_wheel_t *wheel, mqtt_list_t *slots, uint32_t size, uint32_t tick, unsigned long now)
+{
+    uint32_t i;
+
+    if ((NULL == wheel) || (NULL == slots) || (0 == tick) || (0 == size) || (0 != (size & (size - 1))))
+        RETURN_ERROR(MQTT_NULL_VALUE_ERROR);
+
+    for (i = 0; i < size; i++)
+        mqtt_list_init(&slots[i]);
+
+    wheel->slots = slots;
+    wheel->mask = size - 1;
+    wheel->tick = tick;
+    wheel->current = now / tick;
+
+    RETURN_ERROR(MQTT_SUCCESS_ERROR);
+}
+
+void mqtt_wheel_node_init(mqtt_wheel_node_t *node)
+{
+    mqtt_list_init(&node->list);
+    node->expires = 0;
+}
+
+/**
+ * @brief 添加节点，节点已经在时间轮上时先移除
+ * 
+ * @param[in] wheel    时间轮
+ * @param[in] node     节点
+ * @param[in] expires  到期时间（毫秒）
+ */
+void mqtt_wheel_add(mqtt_wheel_t *wheel, mqtt_wheel_node_t *node, unsigned long expires)
+{
+    unsigned long tick = expires / wheel->tick;
+
+    /* 已经过期的节点放到下一个要检查的槽位上 */
+    if ((long)(tick - wheel->current) < 0)
+        tick = wheel->current;
+
+    mqtt_list_del(&node->list);
+    node->expires = expires;
+    mqtt_list_add_tail(&node->list, &wheel->slots[tick & wheel->mask]);
+}
+
+/**
+ * @brief 移除节点，节点不在时间轮上时什么也不做
+ */
+void mqtt_wheel_del(mqtt_wheel_node_t *node)
+{
+    mqtt_list_del_init(&node->list);
+}
+
+/**
+ * @brief 取出一个已经到期的节点
+ * 
+ * 从上次检查的刻度推进到当前刻度，只访问经过的槽位。
+ * 取出的节点已从时间轮上移除，可以在处理时重新添加。
+ * 
+ * @param[in] wheel  时间轮
+ * @param[in] now    当前时间（毫秒）
+ * @return 到期的节点，没有时返回 NULL
+ */
+mqtt_wheel_node_t *mqtt_wheel_pop(mqtt_wheel_t *wheel, unsigned long now)
+{
+    mqtt_list_t *curr, *slot;
+    mqtt_wheel_node_t *node;
+    unsigned long tick = now / wheel->tick;
+
+    /* 超过一圈没有推进时，每个槽位只需要检查一次 */
+    if ((long)(tick - wheel->current) > (long)wheel->mask)
+        wheel->current = tick - wheel->mask;
+
+    for (;;) {
+        slot = &wheel->slots[wheel->current & wheel->mask];
+
+        LIST_FOR_EACH(curr, slot) {
+            node = LIST_ENTRY(curr, mqtt_wheel_node_t, list);
+            if ((long)(node->expires - now) <= 0) {
+                mqtt_list_del_init(&node->list);
+                return node;
+            }
+        }
+
+        /* 当前刻度的槽位里可能还有稍后到期的节点，不能越过 */
+        if ((long)(tick - wheel->current) <= 0)
+            return NULL;
+
+        wheel->current++;
+    }
+}
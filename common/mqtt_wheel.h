@@ -0,0 +1,52 @@
+/*
+ * @Author: jiejie
+ * @Github: https://github.com/jiejieTop
+ * @Date: 2026-10-16 23:40:12
+ * @LastEditTime: 2026-10-16 23:40:12
+ * @Description: MQTT 哈希时间轮头文件
+ *               按到期时间把节点挂到 时间 / 刻度 对应的槽位上，
+ *               每次推进只访问经过的槽位，添加、删除都是 O(1)。
+ *               代码属于 jiejie，请根据许可证保留作者信息和源代码。
+ */
+#ifndef _MQTT_WHEEL_H_
+#define _MQTT_WHEEL_H_
+
+#include <stdint.h>
+#include "mqtt_list.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief 时间轮节点，嵌入到需要定时的结构体中
+ */
+typedef struct mqtt_wheel_node {
+    mqtt_list_t         list;           ///< 挂在槽位上的链表节点，不在时间轮上时指向自身
+    unsigned long       expires;        ///< 到期时间（毫秒）
+} mqtt_wheel_node_t;
+
+/**
+ * @brief 时间轮
+ * 
+ * @note 槽位数组由调用者分配，槽位个数必须是 2 的幂。
+ *       到期时间超过一圈的节点留在槽位上，在之后的圈数里再判断。
+ */
+typedef struct mqtt_wheel {
+    mqtt_list_t         *slots;         ///< 槽位数组
+    uint32_t            mask;           ///< 槽位个数 - 1
+    uint32_t            tick;           ///< 每个槽位的时间跨度（毫秒）
+    unsigned long       current;        ///< 下一个要检查的刻度
+} mqtt_wheel_t;
+
+int mqtt_wheel_init(mqtt_wheel_t *wheel, mqtt_list_t *slots, uint32_t size, uint32_t tick, unsigned long now);
+void mqtt_wheel_node_init(mqtt_wheel_node_t *node);
+void mqtt_wheel_add(mqtt_wheel_t *wheel, mqtt_wheel_node_t *node, unsigned long expires);
+void mqtt_wheel_del(mqtt_wheel_node_t *node);
+mqtt_wheel_node_t *mqtt_wheel_pop(mqtt_wheel_t *wheel, unsigned long now);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _MQTT_WHEEL_H_ */
@@ -29,6 +29,7 @@
 #define     MQTT_MAX_PACKET_ID                  (0xFFFF - 1)
 #define     MQTT_TOPIC_LEN_MAX                  64
 #define     MQTT_ACK_HANDLER_NUM_MAX            64
+#define     MQTT_INFLIGHT_TIMEOUT               0           // unit: millisecond, 0 is not waiting
 #define     MQTT_DEFAULT_BUF_SIZE               1024
 #define     MQTT_DEFAULT_CMD_TIMEOUT            5000
 #define     MQTT_MAX_CMD_TIMEOUT                20000
@@ -36,10 +37,45 @@
 #define     MQTT_KEEP_ALIVE_INTERVAL            50         // unit: second
 #define     MQTT_VERSION                        4           // 4 is mqtt 3.1.1
 #define     MQTT_RECONNECT_DEFAULT_DURATION     1000
+#define     MQTT_RECONNECT_MAX_DURATION         60000
+#define     MQTT_RECONNECT_JITTER               MQTT_BACKOFF_JITTER_FULL
+#define     MQTT_RECONNECT_BREAKER_THRESHOLD    0
+#define     MQTT_RECONNECT_BREAKER_COOLDOWN     300000
+#define     MQTT_ENDPOINT_RETRY_INTERVAL        5000
 #define     MQTT_THREAD_STACK_SIZE              2048
 #define     MQTT_THREAD_PRIO                    5
 #define     MQTT_THREAD_TICK                    50
+#define     MQTT_ACK_HASH_SIZE                  64          // must be a power of 2
+#define     MQTT_ACK_WHEEL_SLOTS                64          // must be a power of 2
+#define     MQTT_ACK_WHEEL_TICK                 100         // unit: millisecond
+#define     MQTT_SUBSCRIBE_BATCH_MAX            64
+#define     MQTT_ACK_RTO_MIN                    1000        // unit: millisecond
+#define     MQTT_ACK_RTO_MAX                    60000       // unit: millisecond
 
+// #define     MQTT_USING_REACTOR
+#define     MQTT_REACTOR_EVENT_MAX              64
+#define     MQTT_REACTOR_TICK                   100         // unit: millisecond
+#define     MQTT_REACTOR_WORKER_NUM             4
+
+// #define     MQTT_USING_PUBLISH_ASYNC
+#define     MQTT_PUBLISH_QUEUE_MAX              32
+#define     MQTT_PUBLISH_QUEUE_TICK             10          // unit: millisecond
+
+// #define     MQTT_USING_WRITER_THREAD
+#define     MQTT_WRITER_RING_SIZE               256         // must be a power of 2
+
+// #define     MQTT_USING_ZERO_COPY_DELIVERY
+
+// #define     MQTT_USING_STREAM_RECEIVE
+
+// #define     MQTT_USING_PUBLISH_STREAM
+
+// #define     MQTT_USING_MEMORY_POOL
+#define     MQTT_POOL_BLOCK_MIN                 64          // must be a power of 2
+#define     MQTT_POOL_CLASS_NUM                 7
+#define     MQTT_POOL_SLAB_SIZE                 4096
+
+// #define     MQTT_USING_CLIENT_GROUP
 
 // #define     MQTT_NETWORK_TYPE_NO_TLS
 
@@ -91,6 +91,56 @@ exit:
 }
 
 
+/**
+  * Serializes everything of a publish packet except the payload into the supplied buffer,
+  * so that the payload can be sent straight from the caller's memory right after it
+  * @param buf the buffer into which the packet header will be serialized
+  * @param buflen the length in bytes of the supplied buffer
+  * @param dup integer - the MQTT dup flag
+  * @param qos integer - the MQTT QoS value
+  * @param retained integer - the MQTT retained flag
+  * @param packetid integer - the MQTT packet identifier
+  * @param topicName MQTTString - the MQTT topic in the publish
+  * @param payloadlen integer - the length of the MQTT payload that will follow
+  * @return the length of the serialized header.  <= 0 indicates error
+  */
+int MQTTSerialize_publishHeader(unsigned char* buf, int buflen, unsigned char dup, int qos, unsigned char retained, unsigned short packetid,
+		MQTTString topicName, int payloadlen)
+{
+	unsigned char *ptr = buf;
+	MQTTHeader header = {0};
+	int rem_len = 0;
+	int rc = 0;
+
+	FUNC_ENTRY;
+	rem_len = MQTTSerialize_publishLength(qos, topicName, payloadlen);
+	if (rem_len > 268435455 || MQTTPacket_len(rem_len) - payloadlen > buflen) /* 268435455: max remaining length */
+	{
+		rc = MQTTPACKET_BUFFER_TOO_SHORT;
+		goto exit;
+	}
+
+	header.bits.type = PUBLISH;
+	header.bits.dup = dup;
+	header.bits.qos = qos;
+	header.bits.retain = retained;
+	writeChar(&ptr, header.byte); /* write header */
+
+	ptr += MQTTPacket_encode(ptr, rem_len); /* write remaining length */;
+
+	writeMQTTString(&ptr, topicName);
+
+	if (qos > 0)
+		writeInt(&ptr, packetid);
+
+	rc = ptr - buf;
+
+exit:
+	FUNC_EXIT_RC(rc);
+	return rc;
+}
+
+
 
 /**
   * Serializes the ack packet into the supplied buffer.
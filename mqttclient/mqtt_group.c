@@ -0,0 +1,352 @@
+/*
+ * @Author: jiejie
+ * @Github: https://github.com/jiejieTop
+ * @Date: 2026-10-18 09:20:36
+ * @LastEditTime: 2026-10-18 09:20:36
+ * @Description: MQTT 客户端组实现文件
+ *               发布和订阅都按主题（主题过滤器）的 FNV-1a 散列值选择会话，
+ *               会话断开时不改投其他会话，由该会话自己重连，以免打乱同一主题的顺序。
+ *               代码属于 jiejie，请根据许可证保留作者信息和源代码。
+ */
+#include "mqtt_group.h"
+
+#ifdef MQTT_USING_CLIENT_GROUP
+
+#include <stdio.h>
+#include <string.h>
+#include "platform_memory.h"
+
+#define MQTT_GROUP_CLIENT_ID_SUFFIX     12      // "-" 加上最多 10 位十进制下标和结束符
+
+MQTT_GROUP_SET_DEFINE(user_name, char*)
+MQTT_GROUP_SET_DEFINE(password, char*)
+MQTT_GROUP_SET_DEFINE(host, char*)
+MQTT_GROUP_SET_DEFINE(port, char*)
+MQTT_GROUP_SET_DEFINE(ca, char*)
+MQTT_GROUP_SET_DEFINE(keep_alive_interval, uint16_t)
+MQTT_GROUP_SET_DEFINE(clean_session, uint32_t)
+MQTT_GROUP_SET_DEFINE(version, uint32_t)
+MQTT_GROUP_SET_DEFINE(cmd_timeout, uint32_t)
+MQTT_GROUP_SET_DEFINE(inflight_max, uint32_t)
+MQTT_GROUP_SET_DEFINE(inflight_timeout, uint32_t)
+MQTT_GROUP_SET_DEFINE(read_buf_size, uint32_t)
+MQTT_GROUP_SET_DEFINE(write_buf_size, uint32_t)
+MQTT_GROUP_SET_DEFINE(reconnect_try_duration, uint32_t)
+#ifdef MQTT_USING_REACTOR
+MQTT_GROUP_SET_DEFINE(reactor, mqtt_reactor_t*)
+#endif
+
+/**
+ * @brief 按主题选择会话下标
+ */
+static uint32_t mqtt_group_index(mqtt_group_t *g, const char *topic)
+{
+    uint32_t hash = 2166136261u;
+
+    while ('\0' != *topic) {
+        hash ^= (uint8_t)*topic++;
+        hash *= 16777619u;
+    }
+
+    return hash % g->client_number;
+}
+
+/**
+ * @brief 释放组内的会话和组本身
+ *
+ * @return 释放失败的会话个数，这些会话（以及组）不释放
+ */
+static uint32_t mqtt_group_free(mqtt_group_t *g)
+{
+    uint32_t i, failed = 0;
+
+    for (i = 0; i < g->client_number; i++) {
+        if (NULL == g->clients[i])
+            continue;
+
+        if (MQTT_SUCCESS_ERROR != mqtt_release(g->clients[i])) {
+            failed++;
+            continue;
+        }
+
+        platform_memory_free(g->clients[i]);
+        g->clients[i] = NULL;
+    }
+
+    if (0 != failed)
+        return failed;
+
+    platform_mutex_destroy(&g->published_lock);
+    platform_memory_free(g->published);
+    platform_memory_free(g->client_ids);
+    platform_memory_free(g->clients);
+    platform_memory_free(g);
+
+    return 0;
+}
+
+/**
+ * @brief 申请客户端组
+ *
+ * 创建 client_number 个会话，第 i 个会话的客户端 ID 为 "<client_id>-<i>"。
+ * 其他参数可通过 mqtt_group_set_xxx() 统一设置，或通过 mqtt_group_client() 单独设置。
+ *
+ * @param[in] client_id      客户端 ID 前缀，调用返回后即可释放
+ * @param[in] client_number  会话数量，为 0 时按 1 处理
+ * @return 客户端组，参数错误或内存不足时返回 NULL
+ */
+mqtt_group_t *mqtt_group_lease(const char *client_id, uint32_t client_number)
+{
+    uint32_t i;
+    size_t id_size;
+    mqtt_group_t *g;
+
+    if (NULL == client_id)
+        return NULL;
+
+    if (0 == client_number)
+        client_number = 1;
+
+    g = (mqtt_group_t *)platform_memory_calloc(1, sizeof(mqtt_group_t));
+    if (NULL == g)
+        return NULL;
+
+    platform_mutex_init(&g->published_lock);
+    id_size = strlen(client_id) + MQTT_GROUP_CLIENT_ID_SUFFIX;
+    g->clients = (mqtt_client_t **)platform_memory_calloc(client_number, sizeof(mqtt_client_t *));
+    g->client_ids = (char *)platform_memory_calloc(client_number, id_size);
+    g->published = (uint32_t *)platform_memory_calloc(client_number, sizeof(uint32_t));
+    g->client_number = client_number;
+
+    if ((NULL == g->clients) || (NULL == g->client_ids) || (NULL == g->published))
+        goto fail;
+
+    for (i = 0; i < client_number; i++) {
+        g->clients[i] = mqtt_lease();
+        if (NULL == g->clients[i])
+            goto fail;
+
+        snprintf(&g->client_ids[i * id_size], id_size, "%s-%u", client_id, (unsigned int)i);
+        mqtt_set_client_id(g->clients[i], &g->client_ids[i * id_size]);
+    }
+
+    return g;
+
+fail:
+    MQTT_LOG_E("%s:%d %s()... mqtt group lease failed...", __FILE__, __LINE__, __FUNCTION__);
+    if (NULL != g->clients) {
+        mqtt_group_free(g);
+    } else {
+        platform_mutex_destroy(&g->published_lock);
+        platform_memory_free(g->published);
+        platform_memory_free(g->client_ids);
+        platform_memory_free(g);
+    }
+    return NULL;
+}
+
+/**
+ * @brief 释放客户端组
+ *
+ * @param[in] g  客户端组
+ * @return
+ *   - MQTT_SUCCESS_ERROR: 释放成功
+ *   - MQTT_NULL_VALUE_ERROR: 参数为空
+ *   - MQTT_FAILED_ERROR: 有会话释放失败（如仍处于连接状态），需先调用 mqtt_group_disconnect()
+ */
+int mqtt_group_release(mqtt_group_t *g)
+{
+    if (NULL == g)
+        RETURN_ERROR(MQTT_NULL_VALUE_ERROR);
+
+    if (0 != mqtt_group_free(g))
+        RETURN_ERROR(MQTT_FAILED_ERROR);
+
+    RETURN_ERROR(MQTT_SUCCESS_ERROR);
+}
+
+/**
+ * @brief 获取组内第 index 个会话，用于单独配置
+ */
+mqtt_client_t *mqtt_group_client(mqtt_group_t *g, uint32_t index)
+{
+    if ((NULL == g) || (index >= g->client_number))
+        return NULL;
+
+    return g->clients[index];
+}
+
+/**
+ * @brief 获取主题对应的会话
+ *
+ * 同一主题总是对应同一个会话，通过该会话发布的消息（包括 mqtt_group_publish()）保持顺序。
+ */
+mqtt_client_t *mqtt_group_route(mqtt_group_t *g, const char *topic)
+{
+    if ((NULL == g) || (NULL == topic))
+        return NULL;
+
+    return g->clients[mqtt_group_index(g, topic)];
+}
+
+/**
+ * @brief 连接组内所有会话
+ *
+ * @param[in] g  客户端组
+ * @return
+ *   - MQTT_SUCCESS_ERROR: 所有会话都连接成功
+ *   - MQTT_NULL_VALUE_ERROR: 参数为空
+ *   - 其他: 第一个连接失败的会话的错误码，其余会话仍会尝试连接
+ */
+int mqtt_group_connect(mqtt_group_t *g)
+{
+    int rc, result = MQTT_SUCCESS_ERROR;
+    uint32_t i;
+
+    if (NULL == g)
+        RETURN_ERROR(MQTT_NULL_VALUE_ERROR);
+
+    for (i = 0; i < g->client_number; i++) {
+        rc = mqtt_connect(g->clients[i]);
+        if ((MQTT_SUCCESS_ERROR != rc) && (MQTT_SUCCESS_ERROR == result)) {
+            MQTT_LOG_W("%s:%d %s()... mqtt group client %u connect failed...", __FILE__, __LINE__, __FUNCTION__, (unsigned int)i);
+            result = rc;
+        }
+    }
+
+    RETURN_ERROR(result);
+}
+
+/**
+ * @brief 断开组内所有连接过的会话
+ *
+ * 断开或正在退避重连的会话仍有内部线程（或事件循环节点），同样需要调用 mqtt_disconnect() 清理，
+ * 否则 mqtt_group_release() 会一直等待；这些会话的连接已经不存在，DISCONNECT 发送失败不计入返回值。
+ * 从未连接成功过的会话处于 CLIENT_STATE_INITIALIZED，不需要断开。
+ */
+int mqtt_group_disconnect(mqtt_group_t *g)
+{
+    int rc, result = MQTT_SUCCESS_ERROR;
+    uint32_t i;
+    client_state_t state;
+
+    if (NULL == g)
+        RETURN_ERROR(MQTT_NULL_VALUE_ERROR);
+
+    for (i = 0; i < g->client_number; i++) {
+        mqtt_get_state(g->clients[i], &state, NULL);
+
+        /* 从未连接过、已经在清理或清理完成的会话不需要断开 */
+        if ((CLIENT_STATE_INITIALIZED == state) || (CLIENT_STATE_CLEAN_SESSION == state) || (CLIENT_STATE_INVALID == state))
+            continue;
+
+        rc = mqtt_disconnect(g->clients[i]);
+        if ((CLIENT_STATE_CONNECTED == state) && (MQTT_SUCCESS_ERROR == result))
+            result = rc;
+    }
+
+    RETURN_ERROR(result);
+}
+
+/**
+ * @brief 按主题选择会话发布消息
+ *
+ * @note 选中的会话断开时发布失败，不会改由其他会话发布，以保持该主题的顺序。
+ */
+int mqtt_group_publish(mqtt_group_t *g, const char *topic_filter, mqtt_message_t *msg)
+{
+    int rc;
+    uint32_t index;
+
+    if ((NULL == g) || (NULL == topic_filter))
+        RETURN_ERROR(MQTT_NULL_VALUE_ERROR);
+
+    index = mqtt_group_index(g, topic_filter);
+
+    rc = mqtt_publish(g->clients[index], topic_filter, msg);
+    if (MQTT_SUCCESS_ERROR == rc) {
+        platform_mutex_lock(&g->published_lock);
+        g->published[index]++;
+        platform_mutex_unlock(&g->published_lock);
+    }
+
+    RETURN_ERROR(rc);
+}
+
+/**
+ * @brief 按主题过滤器选择会话订阅
+ *
+ * 每个主题过滤器只在一个会话上订阅，同一条消息不会被多个会话重复接收，
+ * 匹配该过滤器的消息按服务器发送的顺序在这个会话上接收。
+ * 不含通配符的过滤器与同名主题的发布使用同一个会话。
+ */
+int mqtt_group_subscribe(mqtt_group_t *g, const char *topic_filter, mqtt_qos_t qos, message_handler_t msg_handler)
+{
+    if ((NULL == g) || (NULL == topic_filter))
+        RETURN_ERROR(MQTT_NULL_VALUE_ERROR);
+
+    return mqtt_subscribe(g->clients[mqtt_group_index(g, topic_filter)], topic_filter, qos, msg_handler);
+}
+
+/**
+ * @brief 取消 mqtt_group_subscribe() 的订阅
+ */
+int mqtt_group_unsubscribe(mqtt_group_t *g, const char *topic_filter)
+{
+    if ((NULL == g) || (NULL == topic_filter))
+        RETURN_ERROR(MQTT_NULL_VALUE_ERROR);
+
+    return mqtt_unsubscribe(g->clients[mqtt_group_index(g, topic_filter)], topic_filter);
+}
+
+/**
+ * @brief 获取客户端组的汇总统计
+ *
+ * @param[in]  g      客户端组
+ * @param[out] stats  汇总统计
+ * @return
+ *   - MQTT_SUCCESS_ERROR: 获取成功
+ *   - MQTT_NULL_VALUE_ERROR: 参数为空
+ */
+int mqtt_group_get_stats(mqtt_group_t *g, mqtt_group_stats_t *stats)
+{
+    uint32_t i, srtt, inflight, published;
+    client_state_t state;
+    mqtt_client_t *c;
+    mqtt_reconnect_stats_t reconnect;
+
+    if ((NULL == g) || (NULL == stats))
+        RETURN_ERROR(MQTT_NULL_VALUE_ERROR);
+
+    memset(stats, 0, sizeof(mqtt_group_stats_t));
+    stats->clients = g->client_number;
+
+    for (i = 0; i < g->client_number; i++) {
+        c = g->clients[i];
+
+        mqtt_get_state(c, &state, &inflight);
+        if (CLIENT_STATE_CONNECTED == state)
+            stats->connected++;
+
+        stats->inflight += inflight;
+
+        platform_mutex_lock(&g->published_lock);
+        published = g->published[i];
+        platform_mutex_unlock(&g->published_lock);
+        stats->published += published;
+        if (published > stats->published_max)
+            stats->published_max = published;
+
+        if ((MQTT_SUCCESS_ERROR == mqtt_get_rtt(c, &srtt, NULL, NULL)) && (srtt > stats->srtt_max))
+            stats->srtt_max = srtt;
+
+        if (MQTT_SUCCESS_ERROR == mqtt_get_reconnect_stats(c, &reconnect)) {
+            stats->reconnects += reconnect.successes;
+            stats->reconnect_failures += reconnect.failures;
+        }
+    }
+
+    RETURN_ERROR(MQTT_SUCCESS_ERROR);
+}
+
+#endif /* MQTT_USING_CLIENT_GROUP */
@@ -0,0 +1,103 @@
+/*
+ * @Author: jiejie
+ * @Github: https://github.com/jiejieTop
+ * @Date: 2026-10-18 09:20:36
+ * @LastEditTime: 2026-10-18 09:20:36
+ * @Description: MQTT 客户端组头文件
+ *               一个客户端组向同一服务器建立多个会话（客户端 ID 由组的客户端 ID 派生），
+ *               按主题的散列值选择会话发布，同一主题总是由同一个会话发送，保持每个主题的顺序，
+ *               吞吐量随会话数量（socket、发送缓冲区、发送锁和服务器端的会话队列）增长。
+ *               代码属于 jiejie，请根据许可证保留作者信息和源代码。
+ */
+#ifndef _MQTT_GROUP_H_
+#define _MQTT_GROUP_H_
+
+#include "mqtt_defconfig.h"
+
+#ifdef MQTT_USING_CLIENT_GROUP
+
+#include "mqttclient.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief 客户端组
+ *
+ * @note 每个会话是一个普通的 mqtt_client_t，可以通过 mqtt_group_client() 取得后单独配置，
+ *       或通过 mqtt_group_route() 取得某个主题对应的会话，使用异步发布、报头模板等接口。
+ */
+typedef struct mqtt_group {
+    uint32_t                client_number;  ///< 会话数量
+    mqtt_client_t           **clients;      ///< 会话数组
+    char                    *client_ids;    ///< 派生的客户端 ID："<client_id>-<下标>"
+    uint32_t                *published;     ///< 每个会话通过 mqtt_group_publish() 发布成功的消息数
+    platform_mutex_t        published_lock; ///< 保护 published
+} mqtt_group_t;
+
+/**
+ * @brief 客户端组的汇总统计
+ */
+typedef struct mqtt_group_stats {
+    uint32_t                clients;            ///< 会话数量
+    uint32_t                connected;          ///< 处于连接状态的会话数量
+    uint32_t                inflight;           ///< 所有会话等待确认的报文数之和
+    uint32_t                published;          ///< 通过 mqtt_group_publish() 发布成功的消息总数
+    uint32_t                published_max;      ///< 发布最多的会话的发布数，与 published / clients 比较可以看出主题分布是否均匀
+    uint32_t                srtt_max;           ///< 各会话平滑往返时间的最大值（毫秒），0 表示还没有测量值
+    uint32_t                reconnects;         ///< 所有会话重连成功次数之和
+    uint32_t                reconnect_failures; ///< 所有会话重连失败次数之和
+} mqtt_group_stats_t;
+
+/**
+ * @brief 对组内所有会话调用 mqtt_set_xxx()
+ */
+#define MQTT_GROUP_SET_DEFINE(name, type)                       \
+    int mqtt_group_set_##name(mqtt_group_t *g, type t) {        \
+        uint32_t i;                                             \
+        MQTT_ROBUSTNESS_CHECK((g), MQTT_NULL_VALUE_ERROR);      \
+        for (i = 0; i < g->client_number; i++)                  \
+            mqtt_set_##name(g->clients[i], t);                  \
+        RETURN_ERROR(MQTT_SUCCESS_ERROR);                       \
+    }
+
+#define MQTT_GROUP_SET_STATEMENT(name, type)                    \
+    int mqtt_group_set_##name(mqtt_group_t *, type);
+
+MQTT_GROUP_SET_STATEMENT(user_name, char*)
+MQTT_GROUP_SET_STATEMENT(password, char*)
+MQTT_GROUP_SET_STATEMENT(host, char*)
+MQTT_GROUP_SET_STATEMENT(port, char*)
+MQTT_GROUP_SET_STATEMENT(ca, char*)
+MQTT_GROUP_SET_STATEMENT(keep_alive_interval, uint16_t)
+MQTT_GROUP_SET_STATEMENT(clean_session, uint32_t)
+MQTT_GROUP_SET_STATEMENT(version, uint32_t)
+MQTT_GROUP_SET_STATEMENT(cmd_timeout, uint32_t)
+MQTT_GROUP_SET_STATEMENT(inflight_max, uint32_t)
+MQTT_GROUP_SET_STATEMENT(inflight_timeout, uint32_t)
+MQTT_GROUP_SET_STATEMENT(read_buf_size, uint32_t)
+MQTT_GROUP_SET_STATEMENT(write_buf_size, uint32_t)
+MQTT_GROUP_SET_STATEMENT(reconnect_try_duration, uint32_t)
+#ifdef MQTT_USING_REACTOR
+MQTT_GROUP_SET_STATEMENT(reactor, mqtt_reactor_t*)
+#endif
+
+mqtt_group_t *mqtt_group_lease(const char *client_id, uint32_t client_number);
+int mqtt_group_release(mqtt_group_t *g);
+mqtt_client_t *mqtt_group_client(mqtt_group_t *g, uint32_t index);
+mqtt_client_t *mqtt_group_route(mqtt_group_t *g, const char *topic);
+int mqtt_group_connect(mqtt_group_t *g);
+int mqtt_group_disconnect(mqtt_group_t *g);
+int mqtt_group_publish(mqtt_group_t *g, const char *topic_filter, mqtt_message_t *msg);
+int mqtt_group_subscribe(mqtt_group_t *g, const char *topic_filter, mqtt_qos_t qos, message_handler_t msg_handler);
+int mqtt_group_unsubscribe(mqtt_group_t *g, const char *topic_filter);
+int mqtt_group_get_stats(mqtt_group_t *g, mqtt_group_stats_t *stats);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* MQTT_USING_CLIENT_GROUP */
+
+#endif /* _MQTT_GROUP_H_ */
@@ -0,0 +1,168 @@
+/*
+ * @Author: jiejie
+ * @Github: https://github.com/jiejieTop
+ * @Date: 2026-10-17 13:05:48
+ * @LastEditTime: 2026-10-17 13:05:48
+ * @Description: MQTT 内存池实现文件
+ *               某个等级没有空闲块时一次分配 MQTT_POOL_SLAB_SIZE 大小的 slab 并切分，
+ *               内存块释放后回到所属等级的空闲链表，slab 在销毁内存池时统一释放。
+ *               代码属于 jiejie，请根据许可证保留作者信息和源代码。
+ */
+#include "mqtt_pool.h"
+
+#ifdef MQTT_USING_MEMORY_POOL
+
+#include <string.h>
+#include "platform_memory.h"
+#include "mqtt_error.h"
+
+#define MQTT_POOL_BLOCK_SIZE(index)     ((size_t)MQTT_POOL_BLOCK_MIN << (index))
+
+/**
+ * @brief 计算能容纳 size 字节（含头部）的最小等级
+ *
+ * @return 等级，超过最大等级时返回 MQTT_POOL_CLASS_NUM
+ */
+static uint32_t mqtt_pool_index(size_t size)
+{
+    uint32_t index = 0;
+
+    size += sizeof(mqtt_pool_head_t);
+    while ((index < MQTT_POOL_CLASS_NUM) && (MQTT_POOL_BLOCK_SIZE(index) < size))
+        index++;
+
+    return index;
+}
+
+/**
+ * @brief 为一个等级分配新的 slab，切分后挂到空闲链表
+ *
+ * @note 调用前必须持有内存池的锁。
+ */
+static int mqtt_pool_refill(mqtt_pool_t *pool, uint32_t index)
+{
+    size_t i, count;
+    uint8_t *block;
+    mqtt_pool_slab_t *slab;
+    mqtt_pool_head_t *head;
+
+    count = MQTT_POOL_SLAB_SIZE / MQTT_POOL_BLOCK_SIZE(index);
+    if (0 == count)
+        count = 1;
+
+    slab = (mqtt_pool_slab_t *)platform_memory_alloc(sizeof(mqtt_pool_slab_t) + count * MQTT_POOL_BLOCK_SIZE(index));
+    if (NULL == slab)
+        RETURN_ERROR(MQTT_MEM_NOT_ENOUGH_ERROR);
+
+    slab->next = pool->slabs;
+    pool->slabs = slab;
+
+    block = (uint8_t *)(slab + 1);
+    for (i = 0; i < count; i++) {
+        head = (mqtt_pool_head_t *)(block + i * MQTT_POOL_BLOCK_SIZE(index));
+        head->next = pool->free[index];
+        pool->free[index] = head;
+    }
+
+    RETURN_ERROR(MQTT_SUCCESS_ERROR);
+}
+
+int mqtt_pool_init(mqtt_pool_t *pool)
+{
+    if (NULL == pool)
+        RETURN_ERROR(MQTT_NULL_VALUE_ERROR);
+
+    memset(pool->free, 0, sizeof(pool->free));
+    pool->slabs = NULL;
+    platform_mutex_init(&pool->lock);
+
+    RETURN_ERROR(MQTT_SUCCESS_ERROR);
+}
+
+/**
+ * @brief 从内存池分配内存
+ *
+ * @param[in] pool  内存池
+ * @param[in] size  需要的字节数
+ * @return 分配的内存，内存不足时返回 NULL
+ */
+void *mqtt_pool_alloc(mqtt_pool_t *pool, size_t size)
+{
+    uint32_t index = mqtt_pool_index(size);
+    mqtt_pool_head_t *head;
+
+    /* 大块内存不进入内存池 */
+    if (index >= MQTT_POOL_CLASS_NUM) {
+        head = (mqtt_pool_head_t *)platform_memory_alloc(sizeof(mqtt_pool_head_t) + size);
+        if (NULL == head)
+            return NULL;
+        head->index = MQTT_POOL_CLASS_NUM;
+        return head + 1;
+    }
+
+    platform_mutex_lock(&pool->lock);
+
+    if ((NULL == pool->free[index]) && (MQTT_SUCCESS_ERROR != mqtt_pool_refill(pool, index))) {
+        platform_mutex_unlock(&pool->lock);
+        return NULL;
+    }
+
+    head = pool->free[index];
+    pool->free[index] = head->next;
+
+    platform_mutex_unlock(&pool->lock);
+
+    head->index = index;
+    return head + 1;
+}
+
+/**
+ * @brief 把内存还给内存池
+ *
+ * @param[in] pool  内存池，必须是分配这块内存的内存池
+ * @param[in] ptr   mqtt_pool_alloc() 返回的内存，可为 NULL
+ */
+void mqtt_pool_free(mqtt_pool_t *pool, void *ptr)
+{
+    uint32_t index;
+    mqtt_pool_head_t *head;
+
+    if (NULL == ptr)
+        return;
+
+    head = (mqtt_pool_head_t *)ptr - 1;
+    index = head->index;
+
+    if (index >= MQTT_POOL_CLASS_NUM) {
+        platform_memory_free(head);
+        return;
+    }
+
+    platform_mutex_lock(&pool->lock);
+    head->next = pool->free[index];
+    pool->free[index] = head;
+    platform_mutex_unlock(&pool->lock);
+}
+
+/**
+ * @brief 销毁内存池，释放所有 slab
+ *
+ * @note 从内存池分配的内存（直接分配的大块内存除外）随之失效。
+ */
+void mqtt_pool_destroy(mqtt_pool_t *pool)
+{
+    mqtt_pool_slab_t *slab;
+
+    if (NULL == pool)
+        return;
+
+    while (NULL != (slab = pool->slabs)) {
+        pool->slabs = slab->next;
+        platform_memory_free(slab);
+    }
+
+    memset(pool->free, 0, sizeof(pool->free));
+    platform_mutex_destroy(&pool->lock);
+}
+
+#endif /* MQTT_USING_MEMORY_POOL */
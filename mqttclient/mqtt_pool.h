@@ -0,0 +1,66 @@
+/*
+ * @Author: jiejie
+ * @Github: https://github.com/jiejieTop
+ * @Date: 2026-10-17 13:05:48
+ * @LastEditTime: 2026-10-17 13:05:48
+ * @Description: MQTT 内存池头文件
+ *               按 2 的幂划分大小等级，每个等级从整块的 slab 中切分内存块并维护空闲链表，
+ *               释放的内存块留在池中复用，稳定运行后收发报文不再调用 platform_memory_alloc。
+ *               代码属于 jiejie，请根据许可证保留作者信息和源代码。
+ */
+#ifndef _MQTT_POOL_H_
+#define _MQTT_POOL_H_
+
+#include "mqtt_defconfig.h"
+
+#ifdef MQTT_USING_MEMORY_POOL
+
+#include <stddef.h>
+#include <stdint.h>
+#include "platform_mutex.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief 内存块头部，位于返回给用户的地址之前
+ */
+typedef union mqtt_pool_head {
+    union mqtt_pool_head    *next;          ///< 空闲时：空闲链表中的下一个内存块
+    uint32_t                index;          ///< 使用中：大小等级，MQTT_POOL_CLASS_NUM 表示直接分配的大块内存
+    uint64_t                align;          ///< 保证用户地址按 8 字节对齐
+} mqtt_pool_head_t;
+
+/**
+ * @brief slab 头部，slab 之后是同一等级的若干内存块
+ */
+typedef struct mqtt_pool_slab {
+    struct mqtt_pool_slab   *next;          ///< 下一个 slab，销毁内存池时依次释放
+    uint64_t                align;
+} mqtt_pool_slab_t;
+
+/**
+ * @brief 内存池
+ *
+ * @note 内存池自带互斥锁，可以在不同线程中分配和释放。
+ *       超过最大等级的请求直接使用 platform_memory_alloc()。
+ */
+typedef struct mqtt_pool {
+    platform_mutex_t        lock;
+    mqtt_pool_head_t        *free[MQTT_POOL_CLASS_NUM];     ///< 每个等级的空闲链表
+    mqtt_pool_slab_t        *slabs;                         ///< 已分配的 slab 链表
+} mqtt_pool_t;
+
+int mqtt_pool_init(mqtt_pool_t *pool);
+void *mqtt_pool_alloc(mqtt_pool_t *pool, size_t size);
+void mqtt_pool_free(mqtt_pool_t *pool, void *ptr);
+void mqtt_pool_destroy(mqtt_pool_t *pool);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* MQTT_USING_MEMORY_POOL */
+
+#endif /* _MQTT_POOL_H_ */
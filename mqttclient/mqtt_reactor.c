@@ -0,0 +1,446 @@
+/*
+ * @Author: jiejie
+ * @Github: https://github.com/jiejieTop
+ * @Date: 2026-10-16 10:30:12
+ * @LastEditTime: 2026-10-16 10:30:12
+ * @Description: MQTT 事件循环（reactor）实现文件
+ *               每个事件循环由一个线程驱动，通过 epoll 等待其上所有客户端 socket 的可读事件，
+ *               并按 MQTT_REACTOR_TICK 周期为每个客户端执行保活与重传处理，
+ *               重连等会阻塞的操作交给每个循环的工作线程池执行。
+ *               代码属于 jiejie，请根据许可证保留作者信息和源代码。
+ */
+#include "mqtt_reactor.h"
+
+#ifdef MQTT_USING_REACTOR
+
+#include "platform_memory.h"
+#include "mqtt_error.h"
+#include "mqtt_log.h"
+
+/**
+ * @brief 事件循环线程函数
+ *
+ * 等待 socket 就绪事件并回调对应节点，之后回调被 mqtt_reactor_wakeup() 唤醒的节点，
+ * tick 到期时依次回调该循环上的所有节点。循环锁只在访问节点链表时持有，回调时释放，
+ * 因此用户的消息回调不会阻塞其他线程挂载节点。节点的摘除只能在本线程的回调中完成，
+ * 所以遍历时预先取得的下一个节点在回调期间不会失效。
+ *
+ * @param[in] arg  指向 mqtt_reactor_loop_t 的指针
+ */
+static void mqtt_reactor_loop_thread(void *arg)
+{
+    int i, n;
+    mqtt_list_t *curr, *next;
+    mqtt_reactor_node_t *node;
+    mqtt_reactor_loop_t *loop = (mqtt_reactor_loop_t *)arg;
+    void *ready[MQTT_REACTOR_EVENT_MAX];
+
+    while (loop->running) {
+        n = platform_event_wait(&loop->event, ready, MQTT_REACTOR_EVENT_MAX, platform_timer_remain(&loop->tick));
+
+        for (i = 0; i < n; i++) {
+            node = (mqtt_reactor_node_t *)ready[i];
+            /* 节点可能已在本轮之前被摘除 */
+            if (node->loop == loop)
+                node->handler(node, MQTT_REACTOR_EVENT_READABLE);
+        }
+
+        /* 只回调被唤醒的节点；工作线程正在处理的节点忽略唤醒，等它的回调返回后由 tick 处理 */
+        platform_mutex_lock(&loop->lock);
+        while (!mqtt_list_is_empty(&loop->wakeup_list)) {
+            node = LIST_ENTRY(loop->wakeup_list.next, mqtt_reactor_node_t, wakeup);
+            mqtt_list_del_init(&node->wakeup);
+            if (node->deferred)
+                continue;
+            platform_mutex_unlock(&loop->lock);
+            node->handler(node, MQTT_REACTOR_EVENT_WAKEUP);
+            platform_mutex_lock(&loop->lock);
+        }
+        platform_mutex_unlock(&loop->lock);
+
+        if (platform_timer_is_expired(&loop->tick)) {
+            platform_mutex_lock(&loop->lock);
+            for (curr = loop->node_list.next; curr != &loop->node_list; curr = next) {
+                next = curr->next;
+                node = LIST_ENTRY(curr, mqtt_reactor_node_t, list);
+                /* 工作线程正在处理的节点跳过 tick，等它的回调返回 */
+                if (node->deferred)
+                    continue;
+                platform_mutex_unlock(&loop->lock);
+                node->handler(node, MQTT_REACTOR_EVENT_TICK);
+                platform_mutex_lock(&loop->lock);
+            }
+            platform_mutex_unlock(&loop->lock);
+
+            platform_timer_cutdown(&loop->tick, MQTT_REACTOR_TICK);
+        }
+    }
+
+    loop->exited = 1;
+}
+
+/**
+ * @brief 工作线程函数
+ *
+ * 每个事件循环有 MQTT_REACTOR_WORKER_NUM 个工作线程，各自从 defer_list 取出节点回调
+ * （MQTT_REACTOR_EVENT_DEFERRED），一个节点同一时间只在一个工作线程中处理。
+ * 回调返回后清除节点的 deferred 标志，之后事件循环才会继续对该节点执行 tick。
+ *
+ * @param[in] arg  指向 mqtt_reactor_loop_t 的指针
+ */
+static void mqtt_reactor_worker_thread(void *arg)
+{
+    void *ready[1];
+    mqtt_reactor_node_t *node;
+    mqtt_reactor_loop_t *loop = (mqtt_reactor_loop_t *)arg;
+
+    while (loop->running) {
+        platform_mutex_lock(&loop->lock);
+        node = NULL;
+        if (!mqtt_list_is_empty(&loop->defer_list)) {
+            node = LIST_ENTRY(loop->defer_list.next, mqtt_reactor_node_t, defer);
+            mqtt_list_del_init(&node->defer);
+        }
+        platform_mutex_unlock(&loop->lock);
+
+        if (NULL == node) {
+            platform_event_wait(&loop->worker_event, ready, 1, MQTT_REACTOR_TICK);
+            continue;
+        }
+
+        node->handler(node, MQTT_REACTOR_EVENT_DEFERRED);
+
+        platform_mutex_lock(&loop->lock);
+        node->deferred = 0;
+        platform_mutex_unlock(&loop->lock);
+    }
+
+    platform_mutex_lock(&loop->lock);
+    loop->worker_exited++;
+    platform_mutex_unlock(&loop->lock);
+}
+
+/**
+ * @brief 等待线程退出后销毁线程
+ */
+static void mqtt_reactor_thread_stop(platform_thread_t **thread, volatile int *exited)
+{
+    platform_timer_t timer;
+
+    if (NULL == *thread)
+        return;
+
+    platform_timer_init(&timer);
+    platform_timer_cutdown(&timer, MQTT_DEFAULT_CMD_TIMEOUT);
+    while ((!*exited) && (!platform_timer_is_expired(&timer)))
+        platform_timer_usleep(1000);
+
+    platform_thread_destroy(*thread);
+    platform_memory_free(*thread);
+    *thread = NULL;
+}
+
+/**
+ * @brief 等待所有工作线程退出后销毁它们
+ */
+static void mqtt_reactor_workers_stop(mqtt_reactor_loop_t *loop)
+{
+    unsigned int i;
+    platform_timer_t timer;
+
+    platform_timer_init(&timer);
+    platform_timer_cutdown(&timer, MQTT_DEFAULT_CMD_TIMEOUT);
+    while ((loop->worker_exited < loop->worker_number) && (!platform_timer_is_expired(&timer)))
+        platform_timer_usleep(1000);
+
+    for (i = 0; i < loop->worker_number; i++) {
+        platform_thread_destroy(loop->workers[i]);
+        platform_memory_free(loop->workers[i]);
+        loop->workers[i] = NULL;
+    }
+    loop->worker_number = 0;
+}
+
+static void mqtt_reactor_loop_deinit(mqtt_reactor_loop_t *loop)
+{
+    loop->running = 0;
+    platform_event_wakeup(&loop->event);
+    platform_event_wakeup(&loop->worker_event);
+
+    mqtt_reactor_thread_stop(&loop->thread, &loop->exited);
+    mqtt_reactor_workers_stop(loop);
+
+    platform_event_destroy(&loop->worker_event);
+    platform_event_destroy(&loop->event);
+    platform_mutex_destroy(&loop->lock);
+}
+
+static int mqtt_reactor_loop_init(mqtt_reactor_loop_t *loop)
+{
+    unsigned int i;
+
+    memset(loop, 0, sizeof(mqtt_reactor_loop_t));
+
+    mqtt_list_init(&loop->node_list);
+    mqtt_list_init(&loop->defer_list);
+    mqtt_list_init(&loop->wakeup_list);
+    platform_mutex_init(&loop->lock);
+    platform_timer_init(&loop->tick);
+    platform_timer_cutdown(&loop->tick, MQTT_REACTOR_TICK);
+
+    if (MQTT_SUCCESS_ERROR != platform_event_init(&loop->event)) {
+        platform_mutex_destroy(&loop->lock);
+        RETURN_ERROR(MQTT_FAILED_ERROR);
+    }
+
+    if (MQTT_SUCCESS_ERROR != platform_event_init(&loop->worker_event)) {
+        platform_event_destroy(&loop->event);
+        platform_mutex_destroy(&loop->lock);
+        RETURN_ERROR(MQTT_FAILED_ERROR);
+    }
+
+    loop->running = 1;
+    loop->thread = platform_thread_init("mqtt_reactor_thread", mqtt_reactor_loop_thread, loop,
+                                        MQTT_THREAD_STACK_SIZE, MQTT_THREAD_PRIO, MQTT_THREAD_TICK);
+    if (NULL == loop->thread) {
+        mqtt_reactor_loop_deinit(loop);
+        RETURN_ERROR(MQTT_FAILED_ERROR);
+    }
+
+    for (i = 0; i < MQTT_REACTOR_WORKER_NUM; i++) {
+        loop->workers[i] = platform_thread_init("mqtt_reactor_worker", mqtt_reactor_worker_thread, loop,
+                                                MQTT_THREAD_STACK_SIZE, MQTT_THREAD_PRIO, MQTT_THREAD_TICK);
+        if (NULL == loop->workers[i]) {
+            mqtt_reactor_loop_deinit(loop);
+            RETURN_ERROR(MQTT_FAILED_ERROR);
+        }
+        loop->worker_number++;
+    }
+
+    RETURN_ERROR(MQTT_SUCCESS_ERROR);
+}
+
+/**
+ * @brief 创建事件循环组
+ *
+ * @param[in] loop_number  事件循环线程数量，为 0 时使用 1
+ * @return 事件循环组指针，失败时返回 NULL
+ *
+ * @note 通过 mqtt_set_reactor() 交给客户端使用，连接成功后客户端将挂载到负载最小的循环上，
+ *       不再创建自己的 mqtt_yield_thread。
+ */
+mqtt_reactor_t *mqtt_reactor_lease(unsigned int loop_number)
+{
+    unsigned int i;
+    mqtt_reactor_t *r;
+
+    if (0 == loop_number)
+        loop_number = 1;
+
+    r = (mqtt_reactor_t *)platform_memory_alloc(sizeof(mqtt_reactor_t));
+    if (NULL == r)
+        return NULL;
+
+    r->loops = (mqtt_reactor_loop_t *)platform_memory_calloc(loop_number, sizeof(mqtt_reactor_loop_t));
+    if (NULL == r->loops) {
+        platform_memory_free(r);
+        return NULL;
+    }
+
+    for (i = 0; i < loop_number; i++) {
+        if (MQTT_SUCCESS_ERROR != mqtt_reactor_loop_init(&r->loops[i])) {
+            MQTT_LOG_E("%s:%d %s()... reactor loop init failed...", __FILE__, __LINE__, __FUNCTION__);
+            while (i--)
+                mqtt_reactor_loop_deinit(&r->loops[i]);
+            platform_memory_free(r->loops);
+            platform_memory_free(r);
+            return NULL;
+        }
+    }
+
+    r->loop_number = loop_number;
+
+    return r;
+}
+
+/**
+ * @brief 释放事件循环组
+ *
+ * @param[in] r  事件循环组
+ * @return
+ *   - MQTT_SUCCESS_ERROR: 释放成功
+ *   - MQTT_NULL_VALUE_ERROR: 参数为空
+ *   - MQTT_FAILED_ERROR: 仍有客户端挂载在事件循环上，需先断开并释放这些客户端
+ */
+int mqtt_reactor_release(mqtt_reactor_t *r)
+{
+    unsigned int i;
+
+    if (NULL == r)
+        RETURN_ERROR(MQTT_NULL_VALUE_ERROR);
+
+    for (i = 0; i < r->loop_number; i++) {
+        if (0 != r->loops[i].node_number) {
+            MQTT_LOG_E("%s:%d %s()... there are still clients on the reactor...", __FILE__, __LINE__, __FUNCTION__);
+            RETURN_ERROR(MQTT_FAILED_ERROR);
+        }
+    }
+
+    for (i = 0; i < r->loop_number; i++)
+        mqtt_reactor_loop_deinit(&r->loops[i]);
+
+    platform_memory_free(r->loops);
+    platform_memory_free(r);
+
+    RETURN_ERROR(MQTT_SUCCESS_ERROR);
+}
+
+void mqtt_reactor_node_init(mqtt_reactor_node_t *node, mqtt_reactor_handler_t handler, void *owner)
+{
+    mqtt_list_init(&node->list);
+    mqtt_list_init(&node->defer);
+    mqtt_list_init(&node->wakeup);
+    node->loop = NULL;
+    node->fd = -1;
+    node->deferred = 0;
+    node->handler = handler;
+    node->owner = owner;
+}
+
+/**
+ * @brief 将节点挂载到负载最小的事件循环上，并注册其 socket
+ *
+ * @param[in] r     事件循环组
+ * @param[in] node  要挂载的节点（不能已挂载）
+ * @param[in] fd    要监听的 socket
+ * @return
+ *   - MQTT_SUCCESS_ERROR: 挂载成功
+ *   - MQTT_FAILED_ERROR: 注册 socket 失败
+ *
+ * @note 不能在事件循环线程的回调中调用
+ */
+int mqtt_reactor_attach(mqtt_reactor_t *r, mqtt_reactor_node_t *node, int fd)
+{
+    unsigned int i;
+    mqtt_reactor_loop_t *loop;
+
+    if ((NULL == r) || (NULL == node) || (NULL != node->loop))
+        RETURN_ERROR(MQTT_NULL_VALUE_ERROR);
+
+    loop = &r->loops[0];
+    for (i = 1; i < r->loop_number; i++) {
+        if (r->loops[i].node_number < loop->node_number)
+            loop = &r->loops[i];
+    }
+
+    platform_mutex_lock(&loop->lock);
+
+    node->fd = fd;
+    node->loop = loop;
+    if (MQTT_SUCCESS_ERROR != platform_event_add(&loop->event, fd, node)) {
+        node->loop = NULL;
+        node->fd = -1;
+        platform_mutex_unlock(&loop->lock);
+        RETURN_ERROR(MQTT_FAILED_ERROR);
+    }
+
+    mqtt_list_add_tail(&node->list, &loop->node_list);
+    loop->node_number++;
+
+    platform_mutex_unlock(&loop->lock);
+
+    RETURN_ERROR(MQTT_SUCCESS_ERROR);
+}
+
+/**
+ * @brief 重连成功后重新注册节点的 socket
+ *
+ * 旧的 socket 关闭时已被 epoll 自动移除，这里只需要注册新的 socket。
+ *
+ * @param[in] node  已挂载的节点
+ * @param[in] fd    新的 socket
+ */
+int mqtt_reactor_update(mqtt_reactor_node_t *node, int fd)
+{
+    mqtt_reactor_loop_t *loop;
+
+    if ((NULL == node) || (NULL == node->loop))
+        RETURN_ERROR(MQTT_NULL_VALUE_ERROR);
+
+    loop = (mqtt_reactor_loop_t *)node->loop;
+    node->fd = fd;
+
+    return platform_event_add(&loop->event, fd, node);
+}
+
+/**
+ * @brief 将节点从事件循环上摘除
+ *
+ * @note 只能在事件循环线程的 tick 回调中调用。
+ *       socket 不会从 epoll 中显式删除，调用者随后关闭 socket 即可，
+ *       这样可以避免误删被其他客户端复用的同号 socket。
+ */
+void mqtt_reactor_remove(mqtt_reactor_node_t *node)
+{
+    mqtt_reactor_loop_t *loop = (mqtt_reactor_loop_t *)node->loop;
+
+    if (NULL == loop)
+        return;
+
+    platform_mutex_lock(&loop->lock);
+    mqtt_list_del_init(&node->list);
+    mqtt_list_del_init(&node->wakeup);
+    loop->node_number--;
+    node->loop = NULL;
+    node->fd = -1;
+    platform_mutex_unlock(&loop->lock);
+}
+
+/**
+ * @brief 唤醒节点所在的事件循环，只对该节点回调一次 MQTT_REACTOR_EVENT_WAKEUP
+ *
+ * 可在任意线程中调用，同一节点在被处理前多次唤醒只回调一次，同一循环上的其他节点不受影响。
+ */
+void mqtt_reactor_wakeup(mqtt_reactor_node_t *node)
+{
+    mqtt_reactor_loop_t *loop = (mqtt_reactor_loop_t *)node->loop;
+
+    if (NULL == loop)
+        return;
+
+    platform_mutex_lock(&loop->lock);
+    /* 节点可能在读取 node->loop 之后已被摘除 */
+    if ((node->loop == loop) && mqtt_list_is_empty(&node->wakeup))
+        mqtt_list_add_tail(&node->wakeup, &loop->wakeup_list);
+    platform_mutex_unlock(&loop->lock);
+
+    platform_event_wakeup(&loop->event);
+}
+
+/**
+ * @brief 把节点提交给所在事件循环的工作线程，在工作线程中回调 MQTT_REACTOR_EVENT_DEFERRED
+ *
+ * 用于重连这类会阻塞的操作：建立连接和等待 CONNACK 最长需要 mqtt_cmd_timeout，
+ * 在事件循环线程中执行会使同一循环上的其他客户端停顿。回调返回前节点不会再收到 tick。
+ * 最多 MQTT_REACTOR_WORKER_NUM 个节点同时处理，其余节点按提交顺序排队。
+ *
+ * @note 只能在事件循环线程的 tick 回调中调用。
+ */
+void mqtt_reactor_defer(mqtt_reactor_node_t *node)
+{
+    mqtt_reactor_loop_t *loop = (mqtt_reactor_loop_t *)node->loop;
+
+    if (NULL == loop)
+        return;
+
+    platform_mutex_lock(&loop->lock);
+    if (!node->deferred) {
+        node->deferred = 1;
+        mqtt_list_add_tail(&node->defer, &loop->defer_list);
+    }
+    platform_mutex_unlock(&loop->lock);
+
+    platform_event_wakeup(&loop->worker_event);
+}
+
+#endif /* MQTT_USING_REACTOR */
@@ -0,0 +1,103 @@
+/*
+ * @Author: jiejie
+ * @Github: https://github.com/jiejieTop
+ * @Date: 2026-10-16 10:30:12
+ * @LastEditTime: 2026-10-16 10:30:12
+ * @Description: MQTT 事件循环（reactor）头文件
+ *               多个客户端共享少量事件循环线程，由 epoll 就绪事件驱动报文的读取与处理，
+ *               取代每个客户端一个 mqtt_yield_thread 的模型。
+ *               代码属于 jiejie，请根据许可证保留作者信息和源代码。
+ */
+#ifndef _MQTT_REACTOR_H_
+#define _MQTT_REACTOR_H_
+
+#include "mqtt_defconfig.h"
+
+#ifdef MQTT_USING_REACTOR
+
+#include "mqtt_list.h"
+#include "platform_event.h"
+#include "platform_mutex.h"
+#include "platform_thread.h"
+#include "platform_timer.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+struct mqtt_reactor_node;
+
+#define MQTT_REACTOR_EVENT_TICK         0       ///< 周期性 tick（保活、重传），在事件循环线程中回调
+#define MQTT_REACTOR_EVENT_READABLE     1       ///< socket 可读，在事件循环线程中回调
+#define MQTT_REACTOR_EVENT_DEFERRED     2       ///< mqtt_reactor_defer() 提交的阻塞操作（重连），在工作线程中回调
+#define MQTT_REACTOR_EVENT_WAKEUP       3       ///< mqtt_reactor_wakeup() 唤醒了该节点，在事件循环线程中回调
+
+/**
+ * @brief 事件循环回调函数
+ *
+ * @param[in] node   触发事件的节点
+ * @param[in] event  MQTT_REACTOR_EVENT_XXX
+ *
+ * @note 回调时不持有循环锁，可以执行用户的消息回调。
+ */
+typedef void (*mqtt_reactor_handler_t)(struct mqtt_reactor_node *node, int event);
+
+/**
+ * @brief 挂载到事件循环上的节点，嵌入在 mqtt_client_t 中
+ *
+ * @note 节点只能在事件循环线程中通过 mqtt_reactor_remove() 摘除，
+ *       因此回调执行期间节点所属的客户端不会被释放。
+ *       节点提交到工作线程后，在工作线程回调返回之前不会收到 tick，因此也不会被摘除。
+ */
+typedef struct mqtt_reactor_node {
+    mqtt_list_t                 list;           ///< 链表节点，挂载在事件循环的节点链表上
+    mqtt_list_t                 defer;          ///< 链表节点，等待工作线程处理时挂载在 defer_list 上
+    mqtt_list_t                 wakeup;         ///< 链表节点，被唤醒后挂载在 wakeup_list 上
+    void                        *loop;          ///< 所属的事件循环，NULL 表示未挂载
+    int                         fd;             ///< 当前注册到 epoll 的 socket
+    volatile int                deferred;       ///< 已提交到工作线程，回调返回前为 1，由循环锁保护
+    mqtt_reactor_handler_t      handler;        ///< 事件回调函数
+    void                        *owner;         ///< 回调上下文（通常为 mqtt_client_t）
+} mqtt_reactor_node_t;
+
+/**
+ * @brief 单个事件循环，由一个线程驱动
+ */
+typedef struct mqtt_reactor_loop {
+    platform_event_t            event;          ///< epoll 实例及唤醒通道
+    platform_mutex_t            lock;           ///< 保护节点链表、defer_list 和 wakeup_list
+    mqtt_list_t                 node_list;      ///< 挂载在该循环上的所有节点
+    platform_thread_t           *thread;        ///< 事件循环线程
+    mqtt_list_t                 defer_list;     ///< 等待工作线程处理的节点
+    mqtt_list_t                 wakeup_list;    ///< 被唤醒、等待事件循环处理的节点
+    platform_event_t            worker_event;   ///< 唤醒空闲的工作线程
+    platform_thread_t           *workers[MQTT_REACTOR_WORKER_NUM];  ///< 工作线程，并行执行重连等会阻塞的操作，避免阻塞事件循环
+    unsigned int                worker_number;  ///< 已启动的工作线程数量
+    volatile unsigned int       worker_exited;  ///< 已退出的工作线程数量，由循环锁保护
+    platform_timer_t            tick;           ///< 下一次 tick 的时间点
+    unsigned int                node_number;    ///< 节点数量，用于负载均衡
+    volatile int                running;        ///< 1: 运行中, 0: 请求退出
+    volatile int                exited;         ///< 线程已退出
+} mqtt_reactor_loop_t;
+
+typedef struct mqtt_reactor {
+    unsigned int                loop_number;    ///< 事件循环（线程）数量
+    mqtt_reactor_loop_t         *loops;         ///< 事件循环数组
+} mqtt_reactor_t;
+
+mqtt_reactor_t *mqtt_reactor_lease(unsigned int loop_number);
+int mqtt_reactor_release(mqtt_reactor_t *r);
+void mqtt_reactor_node_init(mqtt_reactor_node_t *node, mqtt_reactor_handler_t handler, void *owner);
+int mqtt_reactor_attach(mqtt_reactor_t *r, mqtt_reactor_node_t *node, int fd);
+int mqtt_reactor_update(mqtt_reactor_node_t *node, int fd);
+void mqtt_reactor_remove(mqtt_reactor_node_t *node);
+void mqtt_reactor_wakeup(mqtt_reactor_node_t *node);
+void mqtt_reactor_defer(mqtt_reactor_node_t *node);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* MQTT_USING_REACTOR */
+
+#endif /* _MQTT_REACTOR_H_ */
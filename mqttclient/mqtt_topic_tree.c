@@ -0,0 +1,378 @@
+/*
+ * @Author: jiejie
+ * @Github: https://github.com/jiejieTop
+ * @Date: 2026-10-17 09:10:26
+ * @LastEditTime: 2026-10-17 09:10:26
+ * @Description: MQTT 主题树实现文件
+ *               订阅时按层级插入过滤器，收到消息时沿主题的层级下降，
+ *               每一层只访问精确匹配、'+' 和 '#' 三个分支。
+ *               代码属于 jiejie，请根据许可证保留作者信息和源代码。
+ */
+#include <string.h>
+#include "mqtt_topic_tree.h"
+#include "platform_memory.h"
+#include "mqtt_error.h"
+
+static int mqtt_topic_node_match(mqtt_topic_node_t *node, const char *p, const char *end, int first, mqtt_topic_visit_t visit, void *arg);
+
+/**
+ * @brief 比较子节点的层级名称，先比较长度再比较内容
+ */
+static int mqtt_topic_level_compare(const mqtt_topic_node_t *node, const char *level, uint32_t len)
+{
+    if (node->len != len)
+        return (node->len < len) ? -1 : 1;
+
+    return memcmp(node->level, level, len);
+}
+
+/**
+ * @brief 二分查找普通层级的子节点
+ *
+ * @param[in]  node   父节点
+ * @param[in]  level  层级名称
+ * @param[in]  len    层级名称长度
+ * @param[out] pos    找到时为子节点的下标，未找到时为插入位置（可为 NULL）
+ * @return 找到的子节点，未找到时返回 NULL
+ */
+static mqtt_topic_node_t *mqtt_topic_node_child(mqtt_topic_node_t *node, const char *level, uint32_t len, uint32_t *pos)
+{
+    int cmp;
+    uint32_t mid, lo = 0, hi = node->count;
+
+    while (lo < hi) {
+        mid = lo + (hi - lo) / 2;
+        cmp = mqtt_topic_level_compare(node->children[mid], level, len);
+        if (0 == cmp) {
+            lo = mid;
+            break;
+        }
+        if (cmp < 0)
+            lo = mid + 1;
+        else
+            hi = mid;
+    }
+
+    if (NULL != pos)
+        *pos = lo;
+
+    if ((lo < node->count) && (0 == mqtt_topic_level_compare(node->children[lo], level, len)))
+        return node->children[lo];
+
+    return NULL;
+}
+
+static mqtt_topic_node_t *mqtt_topic_node_create(mqtt_topic_node_t *parent, const char *level, uint32_t len)
+{
+    mqtt_topic_node_t *node;
+
+    node = (mqtt_topic_node_t *)platform_memory_alloc(sizeof(mqtt_topic_node_t) + len);
+    if (NULL == node)
+        return NULL;
+
+    memset(node, 0, sizeof(mqtt_topic_node_t));
+    node->parent = parent;
+    node->level = (char *)(node + 1);   /* 层级名称紧跟在节点之后 */
+    node->len = (uint16_t)len;
+    memcpy(node->level, level, len);
+
+    return node;
+}
+
+/**
+ * @brief 释放节点的所有子孙节点，节点本身保留
+ */
+static void mqtt_topic_node_release(mqtt_topic_node_t *node)
+{
+    uint32_t i;
+
+    for (i = 0; i < node->count; i++) {
+        mqtt_topic_node_release(node->children[i]);
+        platform_memory_free(node->children[i]);
+    }
+
+    if (NULL != node->plus) {
+        mqtt_topic_node_release(node->plus);
+        platform_memory_free(node->plus);
+    }
+
+    if (NULL != node->hash) {
+        mqtt_topic_node_release(node->hash);
+        platform_memory_free(node->hash);
+    }
+
+    if (NULL != node->children)
+        platform_memory_free(node->children);
+
+    node->children = NULL;
+    node->plus = NULL;
+    node->hash = NULL;
+    node->count = 0;
+    node->size = 0;
+}
+
+/**
+ * @brief 查找过滤器中一个层级对应的子节点，create 为 1 时不存在则创建
+ */
+static mqtt_topic_node_t *mqtt_topic_node_get(mqtt_topic_node_t *node, const char *level, uint32_t len, int create)
+{
+    uint32_t pos, size;
+    mqtt_topic_node_t *child, **slot = NULL, **children;
+
+    if ((1 == len) && ('+' == level[0]))
+        slot = &node->plus;
+    else if ((1 == len) && ('#' == level[0]))
+        slot = &node->hash;
+
+    if (NULL != slot) {
+        if ((NULL == *slot) && create)
+            *slot = mqtt_topic_node_create(node, level, len);
+        return *slot;
+    }
+
+    child = mqtt_topic_node_child(node, level, len, &pos);
+    if ((NULL != child) || (!create))
+        return child;
+
+    /* 子节点数组已满，按两倍扩容 */
+    if (node->count == node->size) {
+        size = (0 == node->size) ? 4 : node->size * 2;
+        children = (mqtt_topic_node_t **)platform_memory_alloc(sizeof(mqtt_topic_node_t *) * size);
+        if (NULL == children)
+            return NULL;
+
+        if (NULL != node->children) {
+            memcpy(children, node->children, sizeof(mqtt_topic_node_t *) * node->count);
+            platform_memory_free(node->children);
+        }
+        node->children = children;
+        node->size = size;
+    }
+
+    child = mqtt_topic_node_create(node, level, len);
+    if (NULL == child)
+        return NULL;
+
+    memmove(&node->children[pos + 1], &node->children[pos], sizeof(mqtt_topic_node_t *) * (node->count - pos));
+    node->children[pos] = child;
+    node->count++;
+
+    return child;
+}
+
+/**
+ * @brief 从节点开始向上删除不再需要的节点（没有值也没有子节点），根节点保留
+ */
+static void mqtt_topic_node_prune(mqtt_topic_node_t *node)
+{
+    uint32_t pos;
+    mqtt_topic_node_t *parent;
+
+    while ((NULL != (parent = node->parent)) && (NULL == node->value) &&
+           (0 == node->count) && (NULL == node->plus) && (NULL == node->hash)) {
+        if (parent->plus == node)
+            parent->plus = NULL;
+        else if (parent->hash == node)
+            parent->hash = NULL;
+        else if (mqtt_topic_node_child(parent, node->level, node->len, &pos) == node) {
+            memmove(&parent->children[pos], &parent->children[pos + 1], sizeof(mqtt_topic_node_t *) * (parent->count - pos - 1));
+            parent->count--;
+        }
+
+        mqtt_topic_node_release(node);
+        platform_memory_free(node);
+        node = parent;
+    }
+}
+
+/**
+ * @brief 沿过滤器的层级查找节点，create 为 1 时创建缺少的节点
+ *
+ * @return 过滤器最后一层对应的节点，未找到或内存不足时返回 NULL
+ */
+static mqtt_topic_node_t *mqtt_topic_tree_walk(mqtt_topic_tree_t *tree, const char *filter, int create)
+{
+    const char *p = filter, *q;
+    mqtt_topic_node_t *child, *node = &tree->root;
+
+    do {
+        q = strchr(p, '/');
+        if (NULL == q)
+            q = p + strlen(p);
+
+        child = ((q - p) > 0xFFFF) ? NULL : mqtt_topic_node_get(node, p, (uint32_t)(q - p), create);
+        if (NULL == child) {
+            if (create)
+                mqtt_topic_node_prune(node);    /* 删除本次已经创建的节点 */
+            return NULL;
+        }
+
+        node = child;
+        p = q + 1;
+    } while ('/' == *q);
+
+    return node;
+}
+
+/**
+ * @brief 主题的一个层级匹配之后，继续匹配下一层；已经是最后一层时报告匹配结果
+ */
+static int mqtt_topic_node_next(mqtt_topic_node_t *node, const char *q, const char *end, mqtt_topic_visit_t visit, void *arg)
+{
+    int n = 0;
+
+    if (q < end)
+        return mqtt_topic_node_match(node, q + 1, end, 0, visit, arg);
+
+    if (NULL != node->value) {
+        visit(arg, node->value);
+        n++;
+    }
+
+    /* "a/#" 同样匹配 "a" */
+    if ((NULL != node->hash) && (NULL != node->hash->value)) {
+        visit(arg, node->hash->value);
+        n++;
+    }
+
+    return n;
+}
+
+/**
+ * @brief 用主题从 p 开始的层级匹配节点的子节点
+ */
+static int mqtt_topic_node_match(mqtt_topic_node_t *node, const char *p, const char *end, int first, mqtt_topic_visit_t visit, void *arg)
+{
+    int n = 0;
+    const char *q = p;
+    mqtt_topic_node_t *child;
+
+    while ((q < end) && ('/' != *q))
+        q++;
+
+    /* 以 '$' 开头的主题（如 $SYS）不与第一层的通配符匹配 */
+    if (!(first && (p < end) && ('$' == *p))) {
+        if ((NULL != node->hash) && (NULL != node->hash->value)) {
+            visit(arg, node->hash->value);
+            n++;
+        }
+
+        if (NULL != node->plus)
+            n += mqtt_topic_node_next(node->plus, q, end, visit, arg);
+    }
+
+    child = mqtt_topic_node_child(node, p, (uint32_t)(q - p), NULL);
+    if (NULL != child)
+        n += mqtt_topic_node_next(child, q, end, visit, arg);
+
+    return n;
+}
+
+void mqtt_topic_tree_init(mqtt_topic_tree_t *tree)
+{
+    memset(&tree->root, 0, sizeof(mqtt_topic_node_t));
+}
+
+/**
+ * @brief 插入过滤器，过滤器已存在时替换它的值
+ *
+ * @param[in] tree    主题树
+ * @param[in] filter  主题过滤器
+ * @param[in] value   过滤器对应的值，不能为 NULL
+ * @return
+ *   - MQTT_SUCCESS_ERROR: 插入成功
+ *   - MQTT_NULL_VALUE_ERROR: 参数为空
+ *   - MQTT_MEM_NOT_ENOUGH_ERROR: 内存不足
+ */
+int mqtt_topic_tree_insert(mqtt_topic_tree_t *tree, const char *filter, void *value)
+{
+    mqtt_topic_node_t *node;
+
+    if ((NULL == tree) || (NULL == filter) || (NULL == value))
+        RETURN_ERROR(MQTT_NULL_VALUE_ERROR);
+
+    node = mqtt_topic_tree_walk(tree, filter, 1);
+    if (NULL == node)
+        RETURN_ERROR(MQTT_MEM_NOT_ENOUGH_ERROR);
+
+    node->value = value;
+
+    RETURN_ERROR(MQTT_SUCCESS_ERROR);
+}
+
+/**
+ * @brief 按过滤器精确查找（通配符按普通字符比较）
+ *
+ * @return 过滤器对应的值，不存在时返回 NULL
+ */
+void *mqtt_topic_tree_find(mqtt_topic_tree_t *tree, const char *filter)
+{
+    mqtt_topic_node_t *node;
+
+    if ((NULL == tree) || (NULL == filter))
+        return NULL;
+
+    node = mqtt_topic_tree_walk(tree, filter, 0);
+
+    return (NULL != node) ? node->value : NULL;
+}
+
+/**
+ * @brief 删除过滤器，并释放不再需要的节点
+ *
+ * @param[in] tree    主题树
+ * @param[in] filter  主题过滤器
+ * @param[in] value   不为 NULL 时，只有过滤器当前的值等于 value 才删除
+ * @return
+ *   - MQTT_SUCCESS_ERROR: 删除成功
+ *   - MQTT_FAILED_ERROR: 过滤器不存在或值不相等
+ */
+int mqtt_topic_tree_remove(mqtt_topic_tree_t *tree, const char *filter, void *value)
+{
+    mqtt_topic_node_t *node;
+
+    if ((NULL == tree) || (NULL == filter))
+        RETURN_ERROR(MQTT_NULL_VALUE_ERROR);
+
+    node = mqtt_topic_tree_walk(tree, filter, 0);
+    if ((NULL == node) || (NULL == node->value) || ((NULL != value) && (node->value != value)))
+        RETURN_ERROR(MQTT_FAILED_ERROR);
+
+    node->value = NULL;
+    mqtt_topic_node_prune(node);
+
+    RETURN_ERROR(MQTT_SUCCESS_ERROR);
+}
+
+/**
+ * @brief 查找与主题匹配的全部过滤器
+ *
+ * 按 MQTT 规则匹配：'+' 匹配一个层级，'#' 匹配其后任意层级（包括父层级本身），
+ * 以 '$' 开头的主题不与第一层的通配符匹配。
+ *
+ * @param[in] tree   主题树
+ * @param[in] topic  主题，不需要以 '\0' 结尾
+ * @param[in] len    主题长度
+ * @param[in] visit  每个匹配的过滤器调用一次，回调中不能修改主题树
+ * @param[in] arg    传递给回调的用户参数
+ * @return 匹配的过滤器个数
+ */
+int mqtt_topic_tree_match(mqtt_topic_tree_t *tree, const char *topic, uint32_t len, mqtt_topic_visit_t visit, void *arg)
+{
+    if ((NULL == tree) || (NULL == topic) || (NULL == visit))
+        return 0;
+
+    return mqtt_topic_node_match(&tree->root, topic, topic + len, 1, visit, arg);
+}
+
+/**
+ * @brief 删除所有过滤器，过滤器对应的值由调用者释放
+ */
+void mqtt_topic_tree_clear(mqtt_topic_tree_t *tree)
+{
+    if (NULL == tree)
+        return;
+
+    mqtt_topic_node_release(&tree->root);
+    mqtt_topic_tree_init(tree);
+}
@@ -0,0 +1,66 @@
+/*
+ * @Author: jiejie
+ * @Github: https://github.com/jiejieTop
+ * @Date: 2026-10-17 09:10:26
+ * @LastEditTime: 2026-10-17 09:10:26
+ * @Description: MQTT 主题树头文件
+ *               按层级（'/' 分隔）保存订阅的主题过滤器，'+' 与 '#' 作为单独的子节点，
+ *               一次下降即可找到与主题匹配的全部过滤器，开销与订阅数量基本无关。
+ *               代码属于 jiejie，请根据许可证保留作者信息和源代码。
+ */
+#ifndef _MQTT_TOPIC_TREE_H_
+#define _MQTT_TOPIC_TREE_H_
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief 主题树节点，对应过滤器中的一个层级
+ *
+ * @note 普通层级的子节点按 (长度, 内容) 排序保存在数组中，用二分查找定位；
+ *       '+' 和 '#' 子节点单独保存，匹配时不需要查找。
+ */
+typedef struct mqtt_topic_node {
+    struct mqtt_topic_node  *parent;        ///< 父节点，根节点为 NULL
+    struct mqtt_topic_node  **children;     ///< 普通层级的子节点数组（有序）
+    struct mqtt_topic_node  *plus;          ///< '+' 子节点
+    struct mqtt_topic_node  *hash;          ///< '#' 子节点
+    void                    *value;         ///< 以该层级结尾的过滤器对应的值，没有时为 NULL
+    char                    *level;         ///< 层级名称（不含 '/'，不以 '\0' 结尾）
+    uint16_t                len;            ///< 层级名称长度
+    uint32_t                count;          ///< 子节点数组中的节点个数
+    uint32_t                size;           ///< 子节点数组的容量
+} mqtt_topic_node_t;
+
+/**
+ * @brief 主题树
+ *
+ * @note 主题树本身不加锁，由调用者保证互斥。
+ */
+typedef struct mqtt_topic_tree {
+    mqtt_topic_node_t       root;           ///< 根节点，不对应任何层级
+} mqtt_topic_tree_t;
+
+/**
+ * @brief 匹配回调，每个与主题匹配的过滤器调用一次
+ *
+ * @param[in] arg    mqtt_topic_tree_match() 传入的用户参数
+ * @param[in] value  过滤器对应的值
+ */
+typedef void (*mqtt_topic_visit_t)(void *arg, void *value);
+
+void mqtt_topic_tree_init(mqtt_topic_tree_t *tree);
+int mqtt_topic_tree_insert(mqtt_topic_tree_t *tree, const char *filter, void *value);
+void *mqtt_topic_tree_find(mqtt_topic_tree_t *tree, const char *filter);
+int mqtt_topic_tree_remove(mqtt_topic_tree_t *tree, const char *filter, void *value);
+int mqtt_topic_tree_match(mqtt_topic_tree_t *tree, const char *topic, uint32_t len, mqtt_topic_visit_t visit, void *arg);
+void mqtt_topic_tree_clear(mqtt_topic_tree_t *tree);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _MQTT_TOPIC_TREE_H_ */
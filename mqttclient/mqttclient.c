@@ -18,6 +18,35 @@
 #define     MQTT_MIN_PAYLOAD_SIZE   2               // MQTT 最小负载大小（字节）
 #define     MQTT_MAX_PAYLOAD_SIZE   268435455       // MQTT 最大负载大小（268MB）
 
+/* 当前已接收的完整报文在接收缓冲区中的起始地址 */
+#define     MQTT_READ_FRAME(c)      ((c)->mqtt_read_buf + (c)->mqtt_read_pos)
+
+/* 随报文频繁创建、释放的对象从客户端的内存池分配 */
+#ifdef MQTT_USING_MEMORY_POOL
+#define     MQTT_OBJECT_ALLOC(c, size)      mqtt_pool_alloc(&(c)->mqtt_pool, (size))
+#define     MQTT_OBJECT_FREE(c, ptr)        mqtt_pool_free(&(c)->mqtt_pool, (ptr))
+#else
+#define     MQTT_OBJECT_ALLOC(c, size)      platform_memory_alloc(size)
+#define     MQTT_OBJECT_FREE(c, ptr)        platform_memory_free(ptr)
+#endif
+
+/* 从 since 到 now 是否已经过了 interval 毫秒，其他线程刚刷新的 since 可能比 now 晚，按有符号差值比较 */
+#define     MQTT_TIME_IS_ELAPSED(now, since, interval)  ((long)((now) - (since)) >= (long)(interval))
+
+/* 报文 ID 占用位图的字数（报文 ID 从 1 开始，位 0 不使用） */
+#define     MQTT_PACKET_ID_MAP_WORDS    ((MQTT_MAX_PACKET_ID >> 5) + 1)
+
+static void mqtt_packet_id_release(mqtt_client_t *c, int type, uint16_t packet_id);
+static int mqtt_subscribe_frame(mqtt_client_t* c, const mqtt_subscription_t* subs, int count, int install);
+static int mqtt_connect_with_results(mqtt_client_t* c);
+static int mqtt_keep_alive_check(mqtt_client_t* c, unsigned long now);
+
+#ifdef MQTT_USING_STREAM_RECEIVE
+static int mqtt_stream_begin(mqtt_client_t* c, uint32_t frame_len);
+static void mqtt_stream_feed(mqtt_client_t* c);
+static void mqtt_stream_abort(mqtt_client_t* c);
+#endif
+
 /**
  * @brief 默认消息处理函数
  * 
@@ -29,8 +58,8 @@
  */
 static void default_msg_handler(void* client, message_data_t* msg)
 {
-    MQTT_LOG_I("%s:%d %s()...\ntopic: %s, qos: %d, \nmessage:%s", __FILE__, __LINE__, __FUNCTION__, 
-            msg->topic_name, msg->message->qos, (char*)msg->message->payload);
+    MQTT_LOG_I("%s:%d %s()...\ntopic: %.*s, qos: %d, \nmessage:%.*s", __FILE__, __LINE__, __FUNCTION__, 
+            msg->topic_len, msg->topic, msg->message->qos, (int)msg->message->payloadlen, (char*)msg->message->payload);
 }
 
 /**
@@ -44,6 +73,19 @@ static client_state_t mqtt_get_client_state(mqtt_client_t* c)
     return c->mqtt_client_state;
 }
 
+/**
+ * @brief 客户端是否有内部线程或事件循环在驱动（连接成功过，且会话还没有清理）
+ */
+static int mqtt_is_driven(mqtt_client_t* c)
+{
+#ifdef MQTT_USING_REACTOR
+    if (NULL != c->mqtt_reactor_node.loop)
+        return 1;
+#endif
+
+    return (NULL != c->mqtt_thread);
+}
+
 /**
  * @brief 设置 MQTT 客户端状态
  * 
@@ -51,11 +93,22 @@ static client_state_t mqtt_get_client_state(mqtt_client_t* c)
  * 
  * @param[in] c      指向 MQTT 客户端实例的指针
  * @param[in] state  要设置的新状态
+ *
+ * @note mqtt_disconnect() 之后服务器关闭连接，内部线程可能读到连接断开而把状态改为 DISCONNECTED 并重连，
+ *       因此 CLEAN_SESSION 只能由会话清理完成后的 INVALID 覆盖。
  */
 static void mqtt_set_client_state(mqtt_client_t* c, client_state_t state)
 {
+    uint32_t i;
+
     platform_mutex_lock(&c->mqtt_global_lock);
-    c->mqtt_client_state = state;
+    if ((CLIENT_STATE_CLEAN_SESSION != c->mqtt_client_state) || (CLIENT_STATE_INVALID == state))
+        c->mqtt_client_state = state;
+    /* 连接断开时唤醒所有等待发送窗口的发布线程，让它们立即返回 */
+    if (CLIENT_STATE_CONNECTED != c->mqtt_client_state) {
+        for (i = 0; i < c->mqtt_inflight_waiters; i++)
+            platform_sem_post(&c->mqtt_inflight_sem);
+    }
     platform_mutex_unlock(&c->mqtt_global_lock);
 }
 
@@ -115,14 +168,14 @@ static int mqtt_set_publish_dup(mqtt_client_t* c, uint8_t dup)
 }
 
 /**
- * @brief 检查 ACK 处理器数量是否已达上限
+ * @brief 检查 ACK 处理器数量是否已达上限（发送窗口已满）
  * 
  * @param[in] c  指向 MQTT 客户端实例的指针
  * @return 1: 已达上限, 0: 未达上限
  */
 static int mqtt_ack_handler_is_maximum(mqtt_client_t* c)
 {
-    return (c->mqtt_ack_handler_number >= MQTT_ACK_HANDLER_NUM_MAX) ? 1 : 0;
+    return (c->mqtt_ack_handler_number >= c->mqtt_inflight_max) ? 1 : 0;
 }
 
 /**
@@ -157,207 +210,315 @@ static int mqtt_subtract_ack_handler_num(mqtt_client_t* c)
     }
     
     c->mqtt_ack_handler_number--;
+
+    /* 空出了一个位置，唤醒一个等待发送窗口的发布线程 */
+    if (0 != c->mqtt_inflight_waiters)
+        platform_sem_post(&c->mqtt_inflight_sem);
     
 exit:
     platform_mutex_unlock(&c->mqtt_global_lock);
     RETURN_ERROR(rc);
 }
 
+/**
+ * @brief 判断报文 ID 是否仍有 ACK 处理器在等待确认
+ * 
+ * @param[in] c          指向 MQTT 客户端实例的指针
+ * @param[in] packet_id  报文 ID
+ * @return 1: 占用中, 0: 空闲
+ */
+static int mqtt_packet_id_is_used(mqtt_client_t *c, uint16_t packet_id)
+{
+    return (c->mqtt_packet_id_map[packet_id >> 5] >> (packet_id & 31)) & 1;
+}
+
+/**
+ * @brief 在位图中标记报文 ID 被占用
+ * 
+ * @note 调用前必须持有 mqtt_write_lock。
+ */
+static void mqtt_packet_id_mark(mqtt_client_t *c, uint16_t packet_id)
+{
+    c->mqtt_packet_id_map[packet_id >> 5] |= 1u << (packet_id & 31);
+}
+
 /**
  * @brief 获取下一个可用的报文 ID
  * 
- * 线程安全地生成递增的报文 ID，用于匹配请求和响应。
+ * 递增计数器得到候选 ID，跳过位图中仍在等待确认的 ID。
+ * 发送窗口远小于 ID 空间，通常第一个候选 ID 就是空闲的。
  * 
  * @param[in] c  指向 MQTT 客户端实例的指针
- * @return 下一个报文 ID（1-65535 循环）
+ * @return 下一个报文 ID（1 ~ MQTT_MAX_PACKET_ID 循环），所有 ID 都在等待确认时返回 0
+ * 
+ * @note 调用前必须持有 mqtt_write_lock。
  */
 static uint16_t mqtt_get_next_packet_id(mqtt_client_t *c) 
 {
-    platform_mutex_lock(&c->mqtt_global_lock);
-    c->mqtt_packet_id = (c->mqtt_packet_id == MQTT_MAX_PACKET_ID) ? 1 : c->mqtt_packet_id + 1;
-    platform_mutex_unlock(&c->mqtt_global_lock);
-    return c->mqtt_packet_id;
+    uint32_t i;
+    uint16_t packet_id;
+
+    for (i = 0; i < MQTT_MAX_PACKET_ID; i++) {
+        packet_id = (uint16_t)(c->mqtt_packet_id++ % MQTT_MAX_PACKET_ID) + 1;
+        if (!mqtt_packet_id_is_used(c, packet_id))
+            return packet_id;
+    }
+
+    return 0;
 }
 
 /**
- * @brief 解码 MQTT 报文长度字段
+ * @brief 重置接收缓冲区
  * 
- * 按照 MQTT 协议规范解析可变长度字段，最多支持 4 字节编码。
+ * 建立新连接或重新分配接收缓冲区时调用，丢弃上一个连接残留的数据。
  * 
- * @param[in]  c      指向 MQTT 客户端实例的指针
- * @param[out] value  解析出的长度值
- * @param[in]  timeout 读取超时时间（毫秒）
- * @return 读取的字节数，失败时返回错误码
+ * @param[in] c  指向 MQTT 客户端实例的指针
  */
-static int mqtt_decode_packet(mqtt_client_t* c, int* value, int timeout)
+static void mqtt_read_buf_reset(mqtt_client_t* c)
 {
-    uint8_t i;
-    int multiplier = 1;
-    int len = 0;
-    const int MAX_NO_OF_REMAINING_LENGTH_BYTES = 4;
+#ifdef MQTT_USING_STREAM_RECEIVE
+    mqtt_stream_abort(c);
+#endif
+    c->mqtt_read_pos = 0;
+    c->mqtt_read_end = 0;
+    c->mqtt_read_frame_len = 0;
+    c->mqtt_read_discard = 0;
+}
 
-    *value = 0;
-    do {
-        int rc = MQTTPACKET_READ_ERROR;
+/**
+ * @brief 解码接收缓冲区中下一个报文的长度
+ * 
+ * 按照 MQTT 协议规范解析固定报头中的可变长度字段（最多 4 字节），
+ * 只解析已缓存的数据，不从网络读取。
+ * 
+ * @param[in]  c          指向 MQTT 客户端实例的指针
+ * @param[out] frame_len  报文总长度（固定报头 + 剩余长度）
+ * @return 1: 报头完整, 0: 报头尚未接收完整, MQTTPACKET_READ_ERROR: 数据格式错误
+ */
+static int mqtt_decode_packet(mqtt_client_t* c, uint32_t* frame_len)
+{
+    uint32_t i;
+    uint32_t multiplier = 1;
+    uint32_t remain_len = 0;
+    const uint32_t MAX_NO_OF_REMAINING_LENGTH_BYTES = 4;
+    uint8_t *buf = c->mqtt_read_buf + c->mqtt_read_pos;
+    uint32_t avail = c->mqtt_read_end - c->mqtt_read_pos;
+
+    for (i = 1; i < avail; i++) {
+        if (i > MAX_NO_OF_REMAINING_LENGTH_BYTES)
+            return MQTTPACKET_READ_ERROR;   /* 数据格式错误 */
+
+        remain_len += (buf[i] & 127) * multiplier;  /* 按照 MQTT 协议解码长度 */
+        multiplier *= 128;
 
-        if (++len > MAX_NO_OF_REMAINING_LENGTH_BYTES) {
-            rc = MQTTPACKET_READ_ERROR; /* 数据格式错误 */
-            goto exit;
+        if (0 == (buf[i] & 128)) {
+            *frame_len = 1 + i + remain_len;
+            return 1;
         }
-        rc = network_read(c->mqtt_network, &i, 1, timeout);  /* 从网络读取数据 */
-        if (rc != 1)
-            goto exit;
-        *value += (i & 127) * multiplier;   /* 按照 MQTT 协议解码长度 */
-        multiplier *= 128;
-    } while ((i & 128) != 0);
-exit:
-    return len;
+    }
+
+    return (i > MAX_NO_OF_REMAINING_LENGTH_BYTES) ? MQTTPACKET_READ_ERROR : 0;
 }
 
 /**
- * @brief 丢弃损坏的 MQTT 报文数据
+ * @brief 从网络接收数据并追加到接收缓冲区
  * 
- * 当缓冲区大小不足以容纳完整报文时，读取并丢弃剩余数据，
- * 确保网络缓冲区清空，避免影响后续报文处理。
+ * 一次读取尽可能多的数据（受缓冲区剩余空间限制），缓冲区中还有未解析完的半个报文时，
+ * 先把它移动到缓冲区开头，为后续数据腾出空间。
  * 
- * @param[in] c         指向 MQTT 客户端实例的指针
- * @param[in] timer     超时定时器
- * @param[in] packet_len 需要丢弃的报文长度
+ * @param[in] c        指向 MQTT 客户端实例的指针
+ * @param[in] timeout  最长等待时间（毫秒），0 表示只读取 socket 中已有的数据
+ * @return 
+ *   - >0: 读取的字节数
+ *   - 0: 超时，没有数据
+ *   - MQTT_NOT_CONNECT_ERROR: 连接已被对端关闭或出错
  */
-static void mqtt_packet_drain(mqtt_client_t* c, platform_timer_t *timer, int packet_len)
+static int mqtt_read_buf_fill(mqtt_client_t* c, int timeout)
 {
-    int total_bytes_read = 0, read_len = 0, bytes2read = 0;
+    int len;
 
-    if (packet_len < c->mqtt_read_buf_size) {
-        bytes2read = packet_len;
-    } else {
-        bytes2read = c->mqtt_read_buf_size;
+    if (c->mqtt_read_pos > 0) {
+        memmove(c->mqtt_read_buf, c->mqtt_read_buf + c->mqtt_read_pos, c->mqtt_read_end - c->mqtt_read_pos);
+        c->mqtt_read_end -= c->mqtt_read_pos;
+        c->mqtt_read_pos = 0;
     }
 
-    do {
-        read_len = network_read(c->mqtt_network, c->mqtt_read_buf, bytes2read, platform_timer_remain(timer));
-        if (0 != read_len) {
-            total_bytes_read += read_len;
-            if ((packet_len - total_bytes_read) >= c->mqtt_read_buf_size) {
-                bytes2read = c->mqtt_read_buf_size;
-            } else {
-                bytes2read = packet_len - total_bytes_read;
-            }
-        }
-    } while ((total_bytes_read < packet_len) && (0 != read_len));   /* 读取并丢弃所有损坏的数据 */
+    len = network_read_some(c->mqtt_network, c->mqtt_read_buf + c->mqtt_read_end, c->mqtt_read_buf_size - c->mqtt_read_end, timeout);
+    if (len < 0) {
+        MQTT_LOG_W("%s:%d %s()... the connection is closed", __FILE__, __LINE__, __FUNCTION__);
+#ifdef MQTT_USING_STREAM_RECEIVE
+        mqtt_stream_abort(c);
+#endif
+        network_release(c->mqtt_network);
+        mqtt_set_client_state(c, CLIENT_STATE_DISCONNECTED);
+        RETURN_ERROR(MQTT_NOT_CONNECT_ERROR);
+    }
+
+    c->mqtt_read_end += len;
+
+    return len;
 }
 
 /**
  * @brief 读取一个完整的 MQTT 报文
  * 
- * 从网络读取 MQTT 报文头，解析报文类型和长度，然后读取完整的报文数据。
+ * 先从接收缓冲区中拆分报文，缓冲区中没有完整报文时才从网络读取，每次读取都尽量填满缓冲区，
+ * 因此一次系统调用可以收到多个报文。报文在缓冲区中原地解析，直到下一次调用本函数前都有效，
+ * 报文位置为 c->mqtt_read_buf + c->mqtt_read_pos，长度为 c->mqtt_read_frame_len。
  * 
  * @param[in]  c           指向 MQTT 客户端实例的指针
  * @param[out] packet_type 解析出的报文类型
- * @param[in]  timer       超时定时器
+ * @param[in]  timer       超时定时器，已过期的定时器表示只处理已经到达的数据，不等待
  * @return 
  *   - MQTT_SUCCESS_ERROR: 读取成功
  *   - 其他错误码: 读取失败
  */
 static int mqtt_read_packet(mqtt_client_t* c, int* packet_type, platform_timer_t* timer)
 {
-    MQTTHeader header = {0};
     int rc;
-    int len = 1;
-    int remain_len = 0;
+    uint32_t len;
+    uint32_t frame_len = 0;
+    MQTTHeader header = {0};
     
     if (NULL == packet_type)
         RETURN_ERROR(MQTT_NULL_VALUE_ERROR);
 
-    platform_timer_init(timer);
-    platform_timer_cutdown(timer, c->mqtt_cmd_timeout);
+    /* 1. 消费上一个已处理的报文 */
+    c->mqtt_read_pos += c->mqtt_read_frame_len;
+    c->mqtt_read_frame_len = 0;
+
+    while (1) {
+#ifdef MQTT_USING_STREAM_RECEIVE
+        /* 流式接收中：把已缓存的负载交给流式回调 */
+        if (c->mqtt_read_stream > 0)
+            mqtt_stream_feed(c);
+#endif
 
-    /* 1. 读取报文头字节，包含报文类型 */
-    rc = network_read(c->mqtt_network, c->mqtt_read_buf, len, platform_timer_remain(timer));
-    if (rc != len)
-        RETURN_ERROR(MQTT_NOTHING_TO_READ_ERROR);
+        /* 2. 丢弃超出缓冲区大小的报文的剩余部分 */
+        if (c->mqtt_read_discard > 0) {
+            len = c->mqtt_read_end - c->mqtt_read_pos;
+            len = (len < c->mqtt_read_discard) ? len : c->mqtt_read_discard;
+            c->mqtt_read_pos += len;
+            c->mqtt_read_discard -= len;
+        }
 
-    /* 2. 读取剩余长度字段（可变长度编码） */
-    mqtt_decode_packet(c, &remain_len, platform_timer_remain(timer));
+        if (c->mqtt_read_pos == c->mqtt_read_end)
+            c->mqtt_read_pos = c->mqtt_read_end = 0;
+
+        if (0 == c->mqtt_read_discard) {
+            /* 3. 解析剩余长度字段，判断缓冲区中是否已有完整报文 */
+            rc = mqtt_decode_packet(c, &frame_len);
+            if (rc < 0) {
+                /* 数据流已经错乱，无法再找到报文边界，只能断开连接 */
+                MQTT_LOG_E("%s:%d %s()... malformed remaining length", __FILE__, __LINE__, __FUNCTION__);
+                network_release(c->mqtt_network);
+                mqtt_set_client_state(c, CLIENT_STATE_DISCONNECTED);
+                RETURN_ERROR(MQTT_NOT_CONNECT_ERROR);
+            }
 
-    /* 将原始剩余长度编码放回缓冲区 */
-    len += MQTTPacket_encode(c->mqtt_read_buf + len, remain_len); 
+            if (rc > 0) {
+                if (frame_len > c->mqtt_read_buf_size) {
+                    rc = MQTT_BUFFER_TOO_SHORT_ERROR;
+#ifdef MQTT_USING_STREAM_RECEIVE
+                    /* PUBLISH 报文改为流式接收：1 表示已开始，0 表示报头还不完整，需要继续读取 */
+                    rc = mqtt_stream_begin(c, frame_len);
+                    if (rc > 0)
+                        continue;
+#endif
+                    if (rc < 0) {
+                        /* MQTT 缓冲区太小，丢弃整个报文 */
+                        c->mqtt_read_discard = frame_len;
+                        RETURN_ERROR(MQTT_BUFFER_TOO_SHORT_ERROR);
+                    }
+                } else if ((c->mqtt_read_end - c->mqtt_read_pos) >= frame_len) {
+                    break;
+                }
+            }
+        }
 
-    if ((len + remain_len) > c->mqtt_read_buf_size) {
-        
-        /* MQTT 缓冲区太小，读取并丢弃所有损坏的数据 */
-        mqtt_packet_drain(c, timer, remain_len);
+        /* 4. 缓冲区中没有完整报文，从网络读取更多数据 */
+        rc = mqtt_read_buf_fill(c, platform_timer_remain(timer));
+        if (rc < 0)
+            RETURN_ERROR(rc);
 
-        RETURN_ERROR(MQTT_BUFFER_TOO_SHORT_ERROR);
+        if ((0 == rc) && platform_timer_is_expired(timer))
+            RETURN_ERROR(MQTT_NOTHING_TO_READ_ERROR);
     }
 
-    /* 3. 读取报文的剩余部分 */
-    if ((remain_len > 0) && ((rc = network_read(c->mqtt_network, c->mqtt_read_buf + len, remain_len, platform_timer_remain(timer))) != remain_len))
-        RETURN_ERROR(MQTT_NOTHING_TO_READ_ERROR);
+    c->mqtt_read_frame_len = frame_len;
 
-    header.byte = c->mqtt_read_buf[0];
+    header.byte = c->mqtt_read_buf[c->mqtt_read_pos];
     *packet_type = header.bits.type;
-    
-    platform_timer_cutdown(&c->mqtt_last_received, (c->mqtt_keep_alive_interval * 1000)); 
 
     RETURN_ERROR(MQTT_SUCCESS_ERROR);
 }
 
 /**
- * @brief 以阻塞方式发送 MQTT 报文数据
+ * @brief 以阻塞方式分散发送 MQTT 报文数据
  *
- * 该函数将已序列化在写缓冲区中的 MQTT 报文通过底层网络接口发送出去。
- * 发送过程是阻塞的，但受超时时间限制（由 c->mqtt_cmd_timeout 指定）。
- * 若在超时前成功发送全部数据，则更新最后发送时间戳；否则返回错误。
+ * 报文由多个不连续的数据段组成（如写缓冲区中的 PUBLISH 报头 + 用户的负载），
+ * 通过 network_writev 一次系统调用发出，负载不必先拷贝到写缓冲区。
+ * 部分写入时跳过已发送的数据继续发送，直到全部发送完成或超时。
  *
- * @param[in]  c       指向 MQTT 客户端实例
- * @param[in]  length  待发送数据的总长度（字节）
- * @param[out] timer   用于控制本次发送操作的超时定时器（临时使用）
+ * @param[in]     c       指向 MQTT 客户端实例
+ * @param[in,out] iov     待发送的数据段，发送过程中会被修改
+ * @param[in]     iovcnt  数据段个数，不超过 MQTT_IOV_MAX
+ * @param[out]    timer   用于控制本次发送操作的超时定时器（临时使用）
  *
  * @return
  *   - MQTT_SUCCESS_ERROR (0): 数据全部成功发送
  *   - MQTT_SEND_PACKET_ERROR: 发送失败（网络错误或超时）
  *
  * @note
- *   - 本函数使用 platform_timer 实现发送超时控制，防止永久阻塞。
- *   - 发送过程中会分片写入（如 TCP 缓冲区满），通过循环重试完成。
  *   - 成功发送后会刷新 mqtt_last_sent 定时器，用于 Keep-Alive 机制。
- *   - 调用前必须持有 mqtt_write_lock，确保写操作互斥。
+ *   - 同一时刻只能有一个线程写 socket：调用前必须持有 mqtt_write_lock（启用写线程时为 mqtt_writer_lock）。
  *
- * @see network_write(), platform_timer_is_expired(), platform_timer_remain()
+ * @see network_writev(), mqtt_send_packet_iov()
  */
-static int mqtt_send_packet(mqtt_client_t* c, int length, platform_timer_t* timer)
+static int mqtt_write_packet_iov(mqtt_client_t* c, mqtt_iovec_t* iov, int iovcnt, platform_timer_t* timer)
 {
-    int len = 0;   // 每次 network_write 实际写入的字节数
-    int sent = 0;  // 累计已发送的字节数
+    int len = 0;   // 每次 network_writev 实际写入的字节数
 
     // 初始化定时器，并设置超时时间为 c->mqtt_cmd_timeout（单位：毫秒）
     platform_timer_init(timer);
     platform_timer_cutdown(timer, c->mqtt_cmd_timeout);
 
     /* 循环发送数据，直到全部发送完成或超时 */
-    while ((sent < length) && (!platform_timer_is_expired(timer))) {
-        // 调用底层网络接口发送剩余未发送的数据
-        // 从 c->mqtt_write_buf + sent 偏移处开始，尝试发送 (length - sent) 字节
-        // 平台层可根据剩余时间进行阻塞或非阻塞写操作
-        len = network_write(c->mqtt_network, 
-                            &c->mqtt_write_buf[sent], 
-                            length - sent, 
-                            platform_timer_remain(timer));
+    while (iovcnt > 0) {
+        /* 跳过已发送完的数据段 */
+        if (iov->len <= 0) {
+            iov++;
+            iovcnt--;
+            continue;
+        }
+
+        if (platform_timer_is_expired(timer))
+            break;
+
+        len = network_writev(c->mqtt_network, iov, iovcnt, platform_timer_remain(timer));
 
         // 如果写入失败（返回值 <= 0），跳出循环
         if (len <= 0) {
             break;  // 网络错误或连接断开
         }
 
-        sent += len;  // 更新已发送字节数
+        /* 部分写入，推进数据段 */
+        while ((iovcnt > 0) && (len >= iov->len)) {
+            len -= iov->len;
+            iov++;
+            iovcnt--;
+        }
+        if (iovcnt > 0) {
+            iov->buf += len;
+            iov->len -= len;
+        }
     }
 
     // 判断是否成功发送了全部数据
-    if (sent == length) {
+    if (0 == iovcnt) {
         // 发送成功：重置客户端"最后发送时间"定时器
         // 用于后续的 Keep-Alive（PING）机制判断是否需要发送 PINGREQ
-        platform_timer_cutdown(&c->mqtt_last_sent, (c->mqtt_keep_alive_interval * 1000));
+        c->mqtt_last_sent = platform_timer_now();
 
         RETURN_ERROR(MQTT_SUCCESS_ERROR);  // 返回成功
     }
@@ -366,266 +527,854 @@ static int mqtt_send_packet(mqtt_client_t* c, int length, platform_timer_t* time
     RETURN_ERROR(MQTT_SEND_PACKET_ERROR);
 }
 
+#ifdef MQTT_USING_WRITER_THREAD
+
 /**
- * @brief 检查两个主题是否完全相等
- * 
- * 比较两个主题字符串是否完全相同，不支持通配符匹配。
- * 
- * @param[in] topic_filter  主题过滤器
- * @param[in] topic         要比较的主题
- * @return 1: 相等, 0: 不相等
- */
-/**
- * @brief 检查两个主题是否完全相等
+ * @brief 写线程待发送的报文
  * 
- * 比较两个主题字符串是否完全相同，不支持通配符匹配。
- * 
- * @param[in] topic_filter  主题过滤器
- * @param[in] topic         要比较的主题
- * @return 1: 相等, 0: 不相等
+ * 报文在入队时被完整拷贝，入队后与写缓冲区无关，调用者可以立即释放写锁。
  */
-static int mqtt_is_topic_equals(const char *topic_filter, const char *topic)
+typedef struct mqtt_writer_frame {
+    uint32_t            epoch;          // 入队时的连接序号，与当前连接不一致时丢弃
+    int                 len;            // 报文长度
+    unsigned char       *buf;           // 报文数据，紧跟在结构体之后
+} mqtt_writer_frame_t;
+
+static int mqtt_writer_is_running(mqtt_client_t* c)
 {
-    int topic_len = 0;
-    
-    topic_len = strlen(topic);
-    if (strlen(topic_filter) != topic_len) {
-        return 0;
-    }
+    return __atomic_load_n(&c->mqtt_writer_running, __ATOMIC_ACQUIRE);
+}
 
-    if (strncmp(topic_filter, topic, topic_len) == 0) {
-        return 1;
-    }
+static mqtt_writer_frame_t *mqtt_writer_frame_alloc(mqtt_client_t* c, int len)
+{
+    mqtt_writer_frame_t *frame;
 
-    return 0;
+    frame = (mqtt_writer_frame_t *)MQTT_OBJECT_ALLOC(c, sizeof(mqtt_writer_frame_t) + len);
+    if (NULL == frame)
+        return NULL;
+
+    frame->epoch = __atomic_load_n(&c->mqtt_writer_epoch, __ATOMIC_ACQUIRE);
+    frame->len = len;
+    frame->buf = (unsigned char *)frame + sizeof(mqtt_writer_frame_t);
+
+    return frame;
 }
 
 /**
- * @brief 检查主题是否匹配（支持通配符）
+ * @brief 把报文放入写队列，必要时唤醒写线程
  * 
- * 支持 MQTT 通配符匹配：
- * - '+' 匹配单层主题
- * - '#' 匹配多层主题
+ * 不访问 socket，也不需要持有任何锁。队列满时在 mqtt_writer_space_event 上等待写线程取走报文，
+ * 最多等待 mqtt_cmd_timeout。
  * 
- * @param[in] topic_filter  主题过滤器（可包含通配符）
- * @param[in] topic_name    要匹配的主题
- * @return 1: 匹配, 0: 不匹配
+ * @param[in] c      指向 MQTT 客户端实例的指针
+ * @param[in] frame  待发送的报文，无论成功与否都由本函数接管
+ * @return 
+ *   - MQTT_SUCCESS_ERROR: 入队成功
+ *   - MQTT_SEND_PACKET_ERROR: 队列一直是满的
  */
-static char mqtt_topic_is_matched(char* topic_filter, MQTTString* topic_name)
+static int mqtt_writer_submit(mqtt_client_t* c, mqtt_writer_frame_t *frame)
 {
-    char* curf = topic_filter;
-    char* curn = topic_name->lenstring.data;
-    char* curn_end = curn + topic_name->lenstring.len;
+    int rc;
+    platform_timer_t timer;
 
-    while (*curf && curn < curn_end)
-    {
-        if (*curn == '/' && *curf != '/')
-            break;
-        
-        /* 支持 MQTT 主题通配符，如 '#' '+' */
-        if (*curf != '+' && *curf != '#' && *curf != *curn) 
-            break;
-        
-        if (*curf == '+') {
-            char* nextpos = curn + 1;
-            while (nextpos < curn_end && *nextpos != '/')
-                nextpos = ++curn + 1;
+    __atomic_add_fetch(&c->mqtt_writer_pending, 1, __ATOMIC_SEQ_CST);
+
+    if (MQTT_SUCCESS_ERROR != mqtt_ring_push(&c->mqtt_writer_ring, frame)) {
+        platform_timer_init(&timer);
+        platform_timer_cutdown(&timer, c->mqtt_cmd_timeout);
+
+        /* 先登记再重试入队，写线程取走报文后看到登记就会唤醒，唤醒计数不会丢失 */
+        __atomic_add_fetch(&c->mqtt_writer_blocked, 1, __ATOMIC_SEQ_CST);
+        while (MQTT_SUCCESS_ERROR != (rc = mqtt_ring_push(&c->mqtt_writer_ring, frame))) {
+            if (platform_timer_is_expired(&timer) || (!mqtt_writer_is_running(c)))
+                break;
+            platform_event_wait(&c->mqtt_writer_space_event, NULL, 1, platform_timer_remain(&timer));
+        }
+        __atomic_sub_fetch(&c->mqtt_writer_blocked, 1, __ATOMIC_SEQ_CST);
+
+        if (MQTT_SUCCESS_ERROR != rc) {
+            __atomic_sub_fetch(&c->mqtt_writer_pending, 1, __ATOMIC_SEQ_CST);
+            MQTT_OBJECT_FREE(c, frame);
+            MQTT_LOG_W("%s:%d %s()... mqtt writer ring is full...", __FILE__, __LINE__, __FUNCTION__);
+            RETURN_ERROR(MQTT_SEND_PACKET_ERROR);
         }
-        else if (*curf == '#')
-            curn = curn_end - 1;
-        curf++;
-        curn++;
-    };
+    }
+
+    /* 与写线程“先置睡眠标志、再检查队列”配对，保证不会漏掉唤醒 */
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+    if (__atomic_exchange_n(&c->mqtt_writer_sleeping, 0, __ATOMIC_SEQ_CST))
+        platform_event_wakeup(&c->mqtt_writer_event);
 
-    return (curn == curn_end) && (*curf == '\0');
+    RETURN_ERROR(MQTT_SUCCESS_ERROR);
 }
 
 /**
- * @brief 创建新的消息数据结构
- * 
- * 将 MQTT 报文中的主题和消息内容封装成标准格式，供回调函数使用。
- * 
- * @param[out] md          输出消息数据结构
- * @param[in]  topic_name  主题名称
- * @param[in]  message     消息内容
+ * @brief 拷贝分散的数据段为一个报文并放入写队列
  */
-static void mqtt_new_message_data(message_data_t* md, MQTTString* topic_name, mqtt_message_t* message)
+static int mqtt_writer_enqueue(mqtt_client_t* c, mqtt_iovec_t* iov, int iovcnt)
 {
-    int len;
-    len = (topic_name->lenstring.len < MQTT_TOPIC_LEN_MAX - 1) ? topic_name->lenstring.len : MQTT_TOPIC_LEN_MAX - 1;
-    memcpy(md->topic_name, topic_name->lenstring.data, len);
-    md->topic_name[len] = '\0';     /* 主题名称过长将被截断 */
-    md->message = message;
+    int i, len = 0;
+    mqtt_writer_frame_t *frame;
+
+    for (i = 0; i < iovcnt; i++)
+        len += iov[i].len;
+
+    frame = mqtt_writer_frame_alloc(c, len);
+    MQTT_ROBUSTNESS_CHECK(frame, MQTT_MEM_NOT_ENOUGH_ERROR);
+
+    for (i = 0, len = 0; i < iovcnt; i++) {
+        memcpy(frame->buf + len, iov[i].buf, iov[i].len);
+        len += iov[i].len;
+    }
+
+    return mqtt_writer_submit(c, frame);
 }
 
 /**
- * @brief 获取匹配主题的消息处理器
- * 
- * 遍历消息处理器列表，查找与指定主题匹配的处理器。
- * 支持精确匹配和通配符匹配。
+ * @brief 在独立的报文缓冲区中序列化 QoS0 PUBLISH 报文并放入写队列
  * 
- * @param[in] c          指向 MQTT 客户端实例的指针
- * @param[in] topic_name 要匹配的主题
- * @return 匹配的消息处理器，未找到时返回 NULL
+ * QoS0 报文不需要报文 ID 和 ACK 记录，整个过程不使用写缓冲区，也不持有写锁，
+ * 多个发布线程之间互不等待。
  */
-static message_handlers_t *mqtt_get_msg_handler(mqtt_client_t* c, MQTTString* topic_name)
+static int mqtt_writer_publish(mqtt_client_t* c, MQTTString topic, mqtt_message_t* msg)
 {
-    mqtt_list_t *curr, *next;
-    message_handlers_t *msg_handler;
+    int len, head;
+    mqtt_writer_frame_t *frame;
 
-    /* 遍历消息处理器列表，查找匹配的消息处理器 */
-    LIST_FOR_EACH_SAFE(curr, next, &c->mqtt_msg_handler_list) {
-        msg_handler = LIST_ENTRY(curr, message_handlers_t, list);
+    /* 固定报头 1 字节 + 剩余长度最多 4 字节 + 主题长度 2 字节 + 主题 */
+    head = 1 + 4 + 2 + (int)strlen(topic.cstring);
 
-        /* 判断主题是否相等或匹配，支持通配符，如 '#' '+' */
-        if ((NULL != msg_handler->topic_filter) && ((MQTTPacket_equals(topic_name, (char*)msg_handler->topic_filter)) || 
-            (mqtt_topic_is_matched((char*)msg_handler->topic_filter, topic_name)))) {
-                return msg_handler;
-            }
+    frame = mqtt_writer_frame_alloc(c, head + (int)msg->payloadlen);
+    MQTT_ROBUSTNESS_CHECK(frame, MQTT_MEM_NOT_ENOUGH_ERROR);
+
+    len = MQTTSerialize_publishHeader(frame->buf, head, 0, QOS0, msg->retained, 0, topic, msg->payloadlen);
+    if (len <= 0) {
+        MQTT_OBJECT_FREE(c, frame);
+        RETURN_ERROR(MQTT_BUFFER_TOO_SHORT_ERROR);
     }
-    return NULL;
+
+    if (msg->payloadlen > 0)
+        memcpy(frame->buf + len, msg->payload, msg->payloadlen);
+    frame->len = len + (int)msg->payloadlen;
+
+    return mqtt_writer_submit(c, frame);
 }
 
 /**
- * @brief 投递消息到对应的处理器
- * 
- * 根据主题找到对应的消息处理器，创建消息数据结构并调用回调函数。
- * 如果未找到处理器，则调用拦截器处理器（如果存在）。
+ * @brief 把写线程取出的一批报文合并为一次分散写
  * 
- * @param[in] c          指向 MQTT 客户端实例的指针
- * @param[in] topic_name 消息主题
- * @param[in] message    消息内容
- * @return 
- *   - MQTT_SUCCESS_ERROR: 投递成功
- *   - MQTT_FAILED_ERROR: 投递失败
+ * 不属于当前连接的报文直接丢弃（QoS1/QoS2 报文在重连后由 ACK 处理器重发）。
+ * 发送失败时释放 socket 并标记为断开，由 mqtt_yield_thread（或事件循环）重连。
  */
-static int mqtt_deliver_message(mqtt_client_t* c, MQTTString* topic_name, mqtt_message_t* message)
+static void mqtt_writer_flush(mqtt_client_t* c, mqtt_writer_frame_t **frames, int count)
 {
-    int rc = MQTT_FAILED_ERROR;
-    message_handlers_t *msg_handler;
-    
-    /* 获取 MQTT 消息处理器 */
-    msg_handler = mqtt_get_msg_handler(c, topic_name);
-    
-    if (NULL != msg_handler) {
-        message_data_t md;
-        mqtt_new_message_data(&md, topic_name, message);    /* 创建消息数据 */
-        msg_handler->handler(c, &md);       /* 投递消息 */
-        rc = MQTT_SUCCESS_ERROR;
-    } else if (NULL != c->mqtt_interceptor_handler) {
-        message_data_t md;
-        mqtt_new_message_data(&md, topic_name, message);    /* 创建消息数据 */
-        c->mqtt_interceptor_handler(c, &md);
-        rc = MQTT_SUCCESS_ERROR;
+    int i, n = 0;
+    uint32_t epoch;
+    platform_timer_t timer;
+    mqtt_iovec_t iov[MQTT_IOV_MAX];
+
+    platform_mutex_lock(&c->mqtt_writer_lock);
+
+    epoch = __atomic_load_n(&c->mqtt_writer_epoch, __ATOMIC_ACQUIRE);
+    if (CLIENT_STATE_CONNECTED == mqtt_get_client_state(c)) {
+        for (i = 0; i < count; i++) {
+            if (frames[i]->epoch != epoch)
+                continue;
+            iov[n].buf = frames[i]->buf;
+            iov[n].len = frames[i]->len;
+            n++;
+        }
     }
-    
-    memset(message->payload, 0, strlen(message->payload));
-    memset(topic_name->lenstring.data, 0, topic_name->lenstring.len);
 
-    RETURN_ERROR(rc);
+    if ((n > 0) && (MQTT_SUCCESS_ERROR != mqtt_write_packet_iov(c, iov, n, &timer))) {
+        if ((epoch == __atomic_load_n(&c->mqtt_writer_epoch, __ATOMIC_ACQUIRE)) && 
+            (CLIENT_STATE_CONNECTED == mqtt_get_client_state(c))) {
+            MQTT_LOG_W("%s:%d %s()... mqtt writer send failed...", __FILE__, __LINE__, __FUNCTION__);
+            network_release(c->mqtt_network);
+            mqtt_set_client_state(c, CLIENT_STATE_DISCONNECTED);
+        }
+    }
+
+    platform_mutex_unlock(&c->mqtt_writer_lock);
+
+    for (i = 0; i < count; i++)
+        MQTT_OBJECT_FREE(c, frames[i]);
+
+    __atomic_sub_fetch(&c->mqtt_writer_pending, count, __ATOMIC_SEQ_CST);
 }
 
 /**
- * @brief 创建 ACK 处理器
- * 
- * 为需要确认的 MQTT 报文创建 ACK 处理器，用于跟踪重传和超时。
+ * @brief 写线程
  * 
- * @param[in] c           指向 MQTT 客户端实例的指针
- * @param[in] type        报文类型
- * @param[in] packet_id   报文 ID
- * @param[in] payload_len 负载长度
- * @param[in] handler     消息处理器（用于订阅/取消订阅）
- * @return 创建的 ACK 处理器，失败时返回 NULL
+ * 唯一从写队列取报文并写 socket 的线程，每次最多取 MQTT_IOV_MAX 个报文合并发送；
+ * 队列为空时在 mqtt_writer_event 上等待生产者唤醒。
  */
-static ack_handlers_t *mqtt_ack_handler_create(mqtt_client_t* c, int type, uint16_t packet_id, uint16_t payload_len, message_handlers_t* handler)
+static void mqtt_writer_thread(void *arg)
 {
-    ack_handlers_t *ack_handler = NULL;
+    int n;
+    mqtt_client_t *c = (mqtt_client_t *)arg;
+    mqtt_writer_frame_t *frames[MQTT_IOV_MAX];
+
+    while (mqtt_writer_is_running(c)) {
+        for (n = 0; n < MQTT_IOV_MAX; n++) {
+            if (NULL == (frames[n] = (mqtt_writer_frame_t *)mqtt_ring_pop(&c->mqtt_writer_ring)))
+                break;
+        }
 
-    ack_handler = (ack_handlers_t *) platform_memory_alloc(sizeof(ack_handlers_t) + payload_len);
-    if (NULL == ack_handler)
-        return NULL;
+        if (n > 0) {
+            /* 已经腾出了位置，唤醒一个因队列满而等待的发布线程，它入队后写线程还会再次唤醒下一个 */
+            if (__atomic_load_n(&c->mqtt_writer_blocked, __ATOMIC_SEQ_CST))
+                platform_event_wakeup(&c->mqtt_writer_space_event);
+            mqtt_writer_flush(c, frames, n);
+            continue;
+        }
 
-    mqtt_list_init(&ack_handler->list);
-    platform_timer_init(&ack_handler->timer);
-    platform_timer_cutdown(&ack_handler->timer, c->mqtt_cmd_timeout);    /* 超时时间内无响应将被销毁或重发 */
+        __atomic_store_n(&c->mqtt_writer_sleeping, 1, __ATOMIC_SEQ_CST);
+        __atomic_thread_fence(__ATOMIC_SEQ_CST);
+        if (mqtt_ring_is_empty(&c->mqtt_writer_ring) && mqtt_writer_is_running(c))
+            platform_event_wait(&c->mqtt_writer_event, NULL, 1, c->mqtt_cmd_timeout);
+        __atomic_store_n(&c->mqtt_writer_sleeping, 0, __ATOMIC_SEQ_CST);
+    }
 
-    ack_handler->type = type;
-    ack_handler->packet_id = packet_id;
-    ack_handler->payload_len = payload_len;
-    ack_handler->payload = (uint8_t *)ack_handler + sizeof(ack_handlers_t);
-    ack_handler->handler = handler;
-    memcpy(ack_handler->payload, c->mqtt_write_buf, payload_len);    /* 在 ACK 处理器中保存数据 */
-    
-    return ack_handler;
+    /* 丢弃尚未发送的报文 */
+    while (NULL != (frames[0] = (mqtt_writer_frame_t *)mqtt_ring_pop(&c->mqtt_writer_ring))) {
+        MQTT_OBJECT_FREE(c, frames[0]);
+        __atomic_sub_fetch(&c->mqtt_writer_pending, 1, __ATOMIC_SEQ_CST);
+    }
+
+    /* 此后不再访问客户端 */
+    __atomic_store_n(&c->mqtt_writer_alive, 0, __ATOMIC_RELEASE);
 }
 
-/**
- * @brief 销毁 ACK 处理器
- * 
- * 从列表中删除 ACK 处理器并释放内存。
- * 
- * @param[in] ack_handler 要销毁的 ACK 处理器
- */
-static void mqtt_ack_handler_destroy(ack_handlers_t* ack_handler)
-{ 
-    if (NULL != &ack_handler->list) {
-        mqtt_list_del(&ack_handler->list);
-        platform_memory_free(ack_handler);  /* 从列表中删除 ACK 处理器，并释放内存 */
+static int mqtt_writer_start(mqtt_client_t* c)
+{
+    __atomic_store_n(&c->mqtt_writer_running, 1, __ATOMIC_SEQ_CST);
+    __atomic_store_n(&c->mqtt_writer_alive, 1, __ATOMIC_SEQ_CST);
+
+    c->mqtt_writer_thread = platform_thread_init("mqtt_writer_thread", mqtt_writer_thread, c, 
+                                                 MQTT_WRITER_THREAD_STACK_SIZE, MQTT_THREAD_PRIO, MQTT_THREAD_TICK);
+    if (NULL == c->mqtt_writer_thread) {
+        __atomic_store_n(&c->mqtt_writer_running, 0, __ATOMIC_SEQ_CST);
+        __atomic_store_n(&c->mqtt_writer_alive, 0, __ATOMIC_SEQ_CST);
+        RETURN_ERROR(MQTT_FAILED_ERROR);
     }
+
+    platform_thread_startup(c->mqtt_writer_thread);
+    platform_thread_start(c->mqtt_writer_thread);
+
+    RETURN_ERROR(MQTT_SUCCESS_ERROR);
 }
 
 /**
- * @brief 重发 ACK 处理器中的报文
- * 
- * 当 ACK 处理器超时时，重新发送对应的报文。
- * 
- * @param[in] c           指向 MQTT 客户端实例的指针
- * @param[in] ack_handler 要重发的 ACK 处理器
+ * @brief 停止写线程并等待它退出，未发送的报文被丢弃
  */
-static void mqtt_ack_handler_resend(mqtt_client_t* c, ack_handlers_t* ack_handler)
-{ 
-    platform_timer_t timer;
+static void mqtt_writer_stop(mqtt_client_t* c)
+{
+    if (NULL == c->mqtt_writer_thread)
+        return;
+
+    __atomic_store_n(&c->mqtt_writer_running, 0, __ATOMIC_SEQ_CST);
+    platform_event_wakeup(&c->mqtt_writer_event);
+    platform_event_wakeup(&c->mqtt_writer_space_event);
+
+    while (__atomic_load_n(&c->mqtt_writer_alive, __ATOMIC_ACQUIRE))
+        platform_timer_usleep(1000);
+
+    platform_thread_destroy(c->mqtt_writer_thread);
+    platform_memory_free(c->mqtt_writer_thread);
+    c->mqtt_writer_thread = NULL;
+}
+
+/**
+ * @brief 等待写队列中的报文全部写出（或丢弃），用于断开连接前发出 DISCONNECT
+ */
+static void mqtt_writer_drain(mqtt_client_t* c, platform_timer_t* timer)
+{
+    while ((__atomic_load_n(&c->mqtt_writer_pending, __ATOMIC_ACQUIRE) > 0) && (!platform_timer_is_expired(timer)))
+        platform_timer_usleep(1000);
+}
+
+#endif /* MQTT_USING_WRITER_THREAD */
+
+/**
+ * @brief 发送一个由多个数据段组成的 MQTT 报文
+ *
+ * 启用 MQTT_USING_WRITER_THREAD 且已连接时，报文被拷贝到写队列后立即返回，由写线程发送，
+ * 调用者持有 mqtt_write_lock 期间不会阻塞在 socket 上；连接阶段（CONNECT）仍直接发送。
+ *
+ * @param[in]     c       指向 MQTT 客户端实例
+ * @param[in,out] iov     待发送的数据段
+ * @param[in]     iovcnt  数据段个数，不超过 MQTT_IOV_MAX
+ * @param[out]    timer   用于控制本次发送操作的超时定时器（临时使用）
+ *
+ * @return
+ *   - MQTT_SUCCESS_ERROR (0): 发送成功（或已入队）
+ *   - 其他错误码: 发送失败
+ *
+ * @note
+ *   - 调用前必须持有 mqtt_write_lock，确保写操作互斥。
+ *
+ * @see mqtt_write_packet_iov()
+ */
+static int mqtt_send_packet_iov(mqtt_client_t* c, mqtt_iovec_t* iov, int iovcnt, platform_timer_t* timer)
+{
+#ifdef MQTT_USING_WRITER_THREAD
+    int rc;
+
+    if (mqtt_writer_is_running(c) && (CLIENT_STATE_CONNECTED == mqtt_get_client_state(c)))
+        return mqtt_writer_enqueue(c, iov, iovcnt);
+
+    platform_mutex_lock(&c->mqtt_writer_lock);
+    rc = mqtt_write_packet_iov(c, iov, iovcnt, timer);
+    platform_mutex_unlock(&c->mqtt_writer_lock);
+
+    RETURN_ERROR(rc);
+#else
+    return mqtt_write_packet_iov(c, iov, iovcnt, timer);
+#endif
+}
+
+/**
+ * @brief 以阻塞方式发送 MQTT 报文数据
+ *
+ * 该函数将已序列化在写缓冲区中的 MQTT 报文通过底层网络接口发送出去。
+ * 发送过程是阻塞的，但受超时时间限制（由 c->mqtt_cmd_timeout 指定）。
+ *
+ * @param[in]  c       指向 MQTT 客户端实例
+ * @param[in]  length  待发送数据的总长度（字节）
+ * @param[out] timer   用于控制本次发送操作的超时定时器（临时使用）
+ *
+ * @return
+ *   - MQTT_SUCCESS_ERROR (0): 数据全部成功发送
+ *   - MQTT_SEND_PACKET_ERROR: 发送失败（网络错误或超时）
+ *
+ * @note
+ *   - 调用前必须持有 mqtt_write_lock，确保写操作互斥。
+ *
+ * @see mqtt_send_packet_iov()
+ */
+static int mqtt_send_packet(mqtt_client_t* c, int length, platform_timer_t* timer)
+{
+    mqtt_iovec_t iov;
+
+    iov.buf = c->mqtt_write_buf;
+    iov.len = length;
+
+    return mqtt_send_packet_iov(c, &iov, 1, timer);
+}
+
+#ifdef MQTT_USING_PUBLISH_STREAM
+
+/**
+ * @brief 写出一个负载来自数据源的 PUBLISH 报文
+ *
+ * 报头先发送（与第一段负载合并写出），之后负载以 buf 为中转分段读取并写出，
+ * 内存占用与负载大小无关。数据源为文件且连接支持时，负载通过 network_sendfile() 直接发送。
+ *
+ * @param[in]     c            指向 MQTT 客户端实例
+ * @param[in,out] head         已序列化的报头
+ * @param[in]     source       负载数据源
+ * @param[in]     payload_len  负载长度
+ * @param[in]     buf          中转缓冲区
+ * @param[in]     buf_size     中转缓冲区大小
+ * @param[out]    timer        用于控制每次发送的超时定时器
+ *
+ * @return
+ *   - MQTT_SUCCESS_ERROR (0): 发送成功
+ *   - 其他错误码: 发送或读取失败
+ *
+ * @note 调用前必须持有 mqtt_write_lock（启用写线程时还需持有 mqtt_writer_lock）。
+ */
+static int mqtt_publish_stream_write(mqtt_client_t* c, mqtt_iovec_t* head, mqtt_publish_source_t* source, 
+                                     uint32_t payload_len, uint8_t* buf, uint32_t buf_size, platform_timer_t* timer)
+{
+    int rc, len, iovcnt;
+    uint32_t offset = 0;
+    mqtt_iovec_t iov[2];
+
+    if (source->fd >= 0) {
+        if ((rc = mqtt_write_packet_iov(c, head, 1, timer)) != MQTT_SUCCESS_ERROR)
+            RETURN_ERROR(rc);
+
+        while (offset < payload_len) {
+            len = network_sendfile(c->mqtt_network, source->fd, source->offset + offset, 
+                                   (int)(payload_len - offset), c->mqtt_cmd_timeout);
+            if (len <= 0)
+                RETURN_ERROR(MQTT_SEND_PACKET_ERROR);   /* 发送失败、超时或文件比负载长度短 */
+            offset += len;
+        }
+
+        c->mqtt_last_sent = platform_timer_now();
+        RETURN_ERROR(MQTT_SUCCESS_ERROR);
+    }
+
+    iov[0] = *head;
+    iovcnt = 1;
+
+    do {
+        len = (int)(((payload_len - offset) < buf_size) ? (payload_len - offset) : buf_size);
+        if (len > 0) {
+            len = source->read(source->arg, offset, buf, len);
+            if (len <= 0)   /* 第一段读取失败时还没有写出任何数据 */
+                RETURN_ERROR((offset > 0) ? MQTT_SEND_PACKET_ERROR : MQTT_PUBLISH_PACKET_ERROR);
+            iov[iovcnt].buf = buf;
+            iov[iovcnt].len = len;
+            iovcnt++;
+            offset += len;
+        }
+
+        if ((rc = mqtt_write_packet_iov(c, iov, iovcnt, timer)) != MQTT_SUCCESS_ERROR)
+            RETURN_ERROR(rc);
+
+        iovcnt = 0;
+    } while (offset < payload_len);
+
+    RETURN_ERROR(MQTT_SUCCESS_ERROR);
+}
+
+/**
+ * @brief 发送一个负载来自数据源的 PUBLISH 报文
+ *
+ * 报文太大，不能拷贝到写线程的队列中，总是由调用者直接写 socket：先等待写队列中的报文写完，
+ * 再在 mqtt_writer_lock 下发送。报文写出一部分后失败时连接上的数据流已经损坏，
+ * 释放 socket 并标记为断开，由 mqtt_yield_thread（或事件循环）重连，QoS1/QoS2 消息在重连后重发。
+ *
+ * @note 调用前必须持有 mqtt_write_lock。
+ *
+ * @see mqtt_publish_stream_write()
+ */
+static int mqtt_publish_stream_send(mqtt_client_t* c, mqtt_iovec_t* head, mqtt_publish_source_t* source, 
+                                    uint32_t payload_len, uint8_t* buf, uint32_t buf_size, platform_timer_t* timer)
+{
+    int rc;
+
+#ifdef MQTT_USING_WRITER_THREAD
+    platform_timer_init(timer);
+    platform_timer_cutdown(timer, c->mqtt_cmd_timeout);
+    mqtt_writer_drain(c, timer);
+    platform_mutex_lock(&c->mqtt_writer_lock);
+#endif
+
+    rc = mqtt_publish_stream_write(c, head, source, payload_len, buf, buf_size, timer);
+    if ((MQTT_SUCCESS_ERROR != rc) && (MQTT_PUBLISH_PACKET_ERROR != rc) && 
+        (CLIENT_STATE_CONNECTED == mqtt_get_client_state(c))) {
+        MQTT_LOG_W("%s:%d %s()... publish stream failed, close the connection...", __FILE__, __LINE__, __FUNCTION__);
+        network_release(c->mqtt_network);
+        mqtt_set_client_state(c, CLIENT_STATE_DISCONNECTED);
+    }
+
+#ifdef MQTT_USING_WRITER_THREAD
+    platform_mutex_unlock(&c->mqtt_writer_lock);
+#endif
+
+    RETURN_ERROR(rc);
+}
+
+#endif /* MQTT_USING_PUBLISH_STREAM */
+
+/**
+ * @brief 创建新的消息数据结构
+ * 
+ * 将 MQTT 报文中的主题和消息内容封装成标准格式，供回调函数使用。
+ * 
+ * @param[out] md          输出消息数据结构
+ * @param[in]  topic_name  主题名称
+ * @param[in]  message     消息内容
+ */
+static void mqtt_new_message_data(message_data_t* md, MQTTString* topic_name, mqtt_message_t* message)
+{
+#ifndef MQTT_USING_ZERO_COPY_DELIVERY
+    int len;
+    len = (topic_name->lenstring.len < MQTT_TOPIC_LEN_MAX - 1) ? topic_name->lenstring.len : MQTT_TOPIC_LEN_MAX - 1;
+    memcpy(md->topic_name, topic_name->lenstring.data, len);
+    md->topic_name[len] = '\0';     /* 主题名称过长将被截断 */
+#else
+    md->topic_name[0] = '\0';       /* 零拷贝投递：只提供指向接收缓冲区的主题 */
+#endif
+    md->topic = topic_name->lenstring.data;
+    md->topic_len = (uint16_t)topic_name->lenstring.len;
+    md->message = message;
+}
+
+/**
+ * @brief 消息投递的上下文，传递给主题树的匹配回调
+ */
+typedef struct mqtt_delivery {
+    mqtt_client_t       *client;
+    message_data_t      *md;
+} mqtt_delivery_t;
+
+/**
+ * @brief 主题树匹配回调：把消息交给一个匹配的消息处理器
+ */
+static void mqtt_deliver_to_handler(void *arg, void *value)
+{
+    mqtt_delivery_t *delivery = (mqtt_delivery_t *)arg;
+    message_handlers_t *msg_handler = (message_handlers_t *)value;
+
+    msg_handler->handler(delivery->client, delivery->md);
+}
+
+/**
+ * @brief 投递消息到对应的处理器
+ * 
+ * 在主题树中一次下降找到所有与主题匹配的消息处理器（精确匹配与通配符匹配），
+ * 创建消息数据结构并依次调用它们的回调函数。
+ * 如果没有匹配的处理器，则调用拦截器处理器（如果存在）。
+ * 
+ * @param[in] c          指向 MQTT 客户端实例的指针
+ * @param[in] topic_name 消息主题
+ * @param[in] message    消息内容
+ * @return 
+ *   - MQTT_SUCCESS_ERROR: 投递成功
+ *   - MQTT_FAILED_ERROR: 投递失败
+ */
+static int mqtt_deliver_message(mqtt_client_t* c, MQTTString* topic_name, mqtt_message_t* message)
+{
+    int rc = MQTT_FAILED_ERROR;
+    message_data_t md;
+    mqtt_delivery_t delivery;
+#ifndef MQTT_USING_ZERO_COPY_DELIVERY
+    char *tail = (char *)message->payload + message->payloadlen;
+    char saved = *tail;
+
+    /* 负载直接指向接收缓冲区，临时添加结束符以兼容按字符串处理负载的回调，投递后恢复，
+     * 被覆盖的字节可能是下一个报文的开头（接收缓冲区多分配了 1 字节，不会越界） */
+    *tail = '\0';
+#endif
+    
+    mqtt_new_message_data(&md, topic_name, message);    /* 创建消息数据 */
+    delivery.client = c;
+    delivery.md = &md;
+
+    /* 投递给所有匹配的消息处理器 */
+    if (mqtt_topic_tree_match(&c->mqtt_msg_handler_tree, topic_name->lenstring.data, (uint32_t)topic_name->lenstring.len, 
+                              mqtt_deliver_to_handler, &delivery) > 0) {
+        rc = MQTT_SUCCESS_ERROR;
+    } else if (NULL != c->mqtt_interceptor_handler) {
+        c->mqtt_interceptor_handler(c, &md);
+        rc = MQTT_SUCCESS_ERROR;
+    }
+    
+#ifndef MQTT_USING_ZERO_COPY_DELIVERY
+    *tail = saved;
+    memset(topic_name->lenstring.data, 0, topic_name->lenstring.len);
+#endif
+
+    RETURN_ERROR(rc);
+}
+
+/**
+ * @brief 创建 ACK 处理器
+ * 
+ * 为需要确认的 MQTT 报文创建 ACK 处理器，用于跟踪重传和超时。
+ * 
+ * @param[in] c           指向 MQTT 客户端实例的指针
+ * @param[in] type        报文类型
+ * @param[in] packet_id   报文 ID
+ * @param[in] payload_len 写缓冲区中需要保存的报文长度
+ * @param[in] tail        紧跟在写缓冲区数据之后的报文数据（PUBLISH 负载），可为 NULL
+ * @param[in] tail_len    tail 的长度
+ * @param[in] handler     消息处理器（用于订阅/取消订阅）
+ * @return 创建的 ACK 处理器，失败时返回 NULL
+ */
+static ack_handlers_t *mqtt_ack_handler_create(mqtt_client_t* c, int type, uint16_t packet_id, uint32_t payload_len, 
+                                               const uint8_t *tail, uint32_t tail_len, message_handlers_t* handler)
+{
+    ack_handlers_t *ack_handler = NULL;
+
+    ack_handler = (ack_handlers_t *) MQTT_OBJECT_ALLOC(c, sizeof(ack_handlers_t) + payload_len + tail_len);
+    if (NULL == ack_handler)
+        return NULL;
+
+    mqtt_list_init(&ack_handler->list);
+    mqtt_list_init(&ack_handler->hash);
+    mqtt_wheel_node_init(&ack_handler->timer);
+
+    ack_handler->type = type;
+    ack_handler->packet_id = packet_id;
+    ack_handler->payload_len = payload_len + tail_len;
+    ack_handler->payload = (uint8_t *)ack_handler + sizeof(ack_handlers_t);
+    ack_handler->handler = handler;
+    ack_handler->publish_handler = NULL;
+    ack_handler->publish_arg = NULL;
+    ack_handler->sent = 0;
+    ack_handler->retries = 0;
+#ifdef MQTT_USING_PUBLISH_STREAM
+    ack_handler->source_len = 0;
+    ack_handler->source.fd = -1;
+    ack_handler->source.read = NULL;
+#endif
+    memcpy(ack_handler->payload, c->mqtt_write_buf, payload_len);    /* 在 ACK 处理器中保存数据 */
+    if (tail_len > 0)
+        memcpy(ack_handler->payload + payload_len, tail, tail_len);
+    
+    return ack_handler;
+}
+
+/**
+ * @brief 把 ACK 处理器从待确认列表、索引和时间轮上摘下
+ * 
+ * @param[in] c           指向 MQTT 客户端实例的指针
+ * @param[in] ack_handler 要摘下的 ACK 处理器
+ * 
+ * @note 调用前必须持有 mqtt_write_lock。
+ */
+static void mqtt_ack_list_remove(mqtt_client_t* c, ack_handlers_t* ack_handler)
+{
+    mqtt_list_del_init(&ack_handler->list);
+    mqtt_list_del_init(&ack_handler->hash);
+    mqtt_wheel_del(&ack_handler->timer);
+    mqtt_packet_id_release(c, ack_handler->type, ack_handler->packet_id);
+    mqtt_subtract_ack_handler_num(c);
+}
+
+/**
+ * @brief 销毁 ACK 处理器
+ * 
+ * 从列表中删除 ACK 处理器并释放内存。
+ * 
+ * @param[in] c           指向 MQTT 客户端实例的指针
+ * @param[in] ack_handler 要销毁的 ACK 处理器
+ * 
+ * @note 调用前必须持有 mqtt_write_lock。
+ */
+static void mqtt_ack_handler_destroy(mqtt_client_t* c, ack_handlers_t* ack_handler)
+{ 
+    mqtt_ack_list_remove(c, ack_handler);
+    MQTT_OBJECT_FREE(c, ack_handler);  /* 从列表中删除 ACK 处理器，并释放内存 */
+}
+
+/**
+ * @brief 判断 ACK 处理器超时后是否重发报文（QoS1/QoS2 流程），否则超时即失败
+ */
+static int mqtt_ack_handler_is_resend(ack_handlers_t* ack_handler)
+{
+    return ((ack_handler->type == PUBACK) || (ack_handler->type == PUBREC) || 
+            (ack_handler->type == PUBREL) || (ack_handler->type == PUBCOMP));
+}
+
+/**
+ * @brief 把 ACK 处理器挂到时间轮上
+ * 
+ * 需要重发的报文在重发超时（RTO）后到期，每重发一次加倍，最多 MQTT_ACK_RTO_MAX；
+ * 还没有往返时间的测量值时 RTO 为 mqtt_cmd_timeout。SUBACK/UNSUBACK 超时即失败，仍使用 mqtt_cmd_timeout。
+ * 
+ * @param[in] c           指向 MQTT 客户端实例的指针
+ * @param[in] ack_handler ACK 处理器，已在时间轮上时重新计时
+ * 
+ * @note 调用前必须持有 mqtt_write_lock。
+ */
+static void mqtt_ack_handler_arm(mqtt_client_t* c, ack_handlers_t* ack_handler)
+{
+    uint32_t i;
+    unsigned long timeout = c->mqtt_cmd_timeout;
+
+    if (mqtt_ack_handler_is_resend(ack_handler)) {
+        if (0 != c->mqtt_rto)
+            timeout = c->mqtt_rto;
+        for (i = 0; (i < ack_handler->retries) && (timeout < MQTT_ACK_RTO_MAX); i++)
+            timeout <<= 1;
+        if (timeout > MQTT_ACK_RTO_MAX)
+            timeout = MQTT_ACK_RTO_MAX;
+    }
+
+    ack_handler->sent = platform_timer_now();
+    mqtt_wheel_add(&c->mqtt_ack_wheel, &ack_handler->timer, ack_handler->sent + timeout);
+}
+
+/**
+ * @brief 用收到响应的 ACK 处理器测量往返时间，更新 SRTT、RTTVAR 和 RTO
+ * 
+ * 与 TCP 相同（RFC 6298）：SRTT = 7/8 SRTT + 1/8 R，RTTVAR = 3/4 RTTVAR + 1/4 |SRTT - R|，
+ * RTO = SRTT + 4 * RTTVAR，不小于 MQTT_ACK_RTO_MIN。重发过的报文无法区分响应对应哪一次发送，不参与测量。
+ * 
+ * @param[in] c           指向 MQTT 客户端实例的指针
+ * @param[in] ack_handler 收到响应的 ACK 处理器
+ * 
+ * @note 调用前必须持有 mqtt_write_lock。
+ */
+static void mqtt_ack_handler_measure(mqtt_client_t* c, ack_handlers_t* ack_handler)
+{
+    long delta, rtt;
+
+    if ((ack_handler->retries > 0) || 
+        ((ack_handler->type != PUBACK) && (ack_handler->type != PUBREC) && (ack_handler->type != PUBCOMP)))
+        return;
+
+    rtt = (long)(c->mqtt_now - ack_handler->sent);
+    if (rtt < 0)
+        rtt = 0;
+
+    if (0 == c->mqtt_rto) {
+        /* 第一个测量值：SRTT = R，RTTVAR = R / 2 */
+        c->mqtt_srtt = (uint32_t)(rtt << 3);
+        c->mqtt_rttvar = (uint32_t)(rtt << 1);
+    } else {
+        delta = rtt - (long)(c->mqtt_srtt >> 3);
+        c->mqtt_srtt = (uint32_t)((long)c->mqtt_srtt + delta);
+        if (delta < 0)
+            delta = -delta;
+        c->mqtt_rttvar = (uint32_t)((long)c->mqtt_rttvar + delta - (long)(c->mqtt_rttvar >> 2));
+    }
+
+    c->mqtt_rto = (c->mqtt_srtt >> 3) + c->mqtt_rttvar;
+    if (c->mqtt_rto < MQTT_ACK_RTO_MIN)
+        c->mqtt_rto = MQTT_ACK_RTO_MIN;
+    else if (c->mqtt_rto > MQTT_ACK_RTO_MAX)
+        c->mqtt_rto = MQTT_ACK_RTO_MAX;
+}
+
+/**
+ * @brief 重发 ACK 处理器中的报文
+ * 
+ * 当 ACK 处理器超时时，重新发送对应的报文。
+ * 
+ * @param[in] c           指向 MQTT 客户端实例的指针
+ * @param[in] ack_handler 要重发的 ACK 处理器
+ * 
+ * @note 调用前必须持有 mqtt_write_lock。
+ */
+static void mqtt_ack_handler_resend(mqtt_client_t* c, ack_handlers_t* ack_handler)
+{ 
+    platform_timer_t timer;
+    mqtt_iovec_t iov;
     platform_timer_init(&timer);
     platform_timer_cutdown(&timer, c->mqtt_cmd_timeout);
-    platform_timer_cutdown(&ack_handler->timer, c->mqtt_cmd_timeout); /* 超时，重新倒计时 */
+    ack_handler->retries++;
+    mqtt_ack_handler_arm(c, ack_handler);               /* 超时，按加倍后的 RTO 重新倒计时 */
 
-    platform_mutex_lock(&c->mqtt_write_lock);
-    memcpy(c->mqtt_write_buf, ack_handler->payload, ack_handler->payload_len);   /* 从 ACK 处理器复制数据到写缓冲区 */
-    
-    mqtt_send_packet(c, ack_handler->payload_len, &timer);      /* 重发数据 */
-    platform_mutex_unlock(&c->mqtt_write_lock);
+    iov.buf = ack_handler->payload;
+    iov.len = (int)ack_handler->payload_len;
+
+#ifdef MQTT_USING_PUBLISH_STREAM
+    if (ack_handler->source_len > 0)                /* 流式发布只保存了报头，负载从数据源重新读取 */
+        mqtt_publish_stream_send(c, &iov, &ack_handler->source, ack_handler->source_len, 
+                                 c->mqtt_write_buf, c->mqtt_write_buf_size, &timer);
+    else
+#endif
+    mqtt_send_packet_iov(c, &iov, 1, &timer);       /* 直接从 ACK 处理器中重发数据，报文可能大于写缓冲区 */
     MQTT_LOG_W("%s:%d %s()... resend %d package, packet_id is %d ", __FILE__, __LINE__, __FUNCTION__, ack_handler->type, ack_handler->packet_id);
 }
 
 /**
- * @brief 检查 ACK 列表中是否存在指定节点
+ * @brief 返回 packet_id 对应的 ACK 索引桶
  * 
- * 对于 QoS1 和 QoS2 的 MQTT 报文，可以使用报文 ID 和类型作为唯一标识符，
- * 判断节点是否已存在，避免重复添加。
+ * 报文 ID 是递增分配的，待确认的报文数量不超过桶的个数时每个桶中通常只有一个节点
+ * （同一个 ID 的 QoS2 报文在 PUBREC/PUBCOMP 之间切换，服务器的报文 ID 也可能落在同一个桶）。
+ */
+static mqtt_list_t *mqtt_ack_hash_bucket(mqtt_client_t* c, uint16_t packet_id)
+{
+    return &c->mqtt_ack_hash[packet_id & (MQTT_ACK_HASH_SIZE - 1)];
+}
+
+/**
+ * @brief 在 ACK 列表中查找指定的 ACK 处理器
+ * 
+ * 只查找 packet_id 所在的索引桶，与待确认报文的数量无关。
  * 
  * @param[in] c         指向 MQTT 客户端实例的指针
  * @param[in] type      报文类型
  * @param[in] packet_id 报文 ID
- * @return 1: 存在, 0: 不存在
+ * @return 找到的 ACK 处理器，不存在时返回 NULL
+ * 
+ * @note 调用前必须持有 mqtt_write_lock。
  */
-static int mqtt_ack_list_node_is_exist(mqtt_client_t* c, int type, uint16_t packet_id)
+static ack_handlers_t *mqtt_ack_list_find(mqtt_client_t* c, int type, uint16_t packet_id)
 {
-    mqtt_list_t *curr, *next;
+    mqtt_list_t *curr, *bucket;
     ack_handlers_t *ack_handler;
 
-    if (mqtt_list_is_empty(&c->mqtt_ack_handler_list))
-        return 0;
+    bucket = mqtt_ack_hash_bucket(c, packet_id);
 
-    LIST_FOR_EACH_SAFE(curr, next, &c->mqtt_ack_handler_list) {
-        ack_handler = LIST_ENTRY(curr, ack_handlers_t, list);
+    LIST_FOR_EACH(curr, bucket) {
+        ack_handler = LIST_ENTRY(curr, ack_handlers_t, hash);
 
-         /* 对于 QoS1 和 QoS2 的 MQTT 报文，可以使用报文 ID 和类型作为唯一
-            标识符来判断节点是否已存在，避免重复添加。 */
-        if ((packet_id  == ack_handler->packet_id) && (type == ack_handler->type))     
-            return 1;
+        if ((packet_id == ack_handler->packet_id) && (type == ack_handler->type))
+            return ack_handler;
     }
+
+    return NULL;
+}
+
+/**
+ * @brief ACK 处理器摘下后，若该报文 ID 不再有本端的 ACK 处理器，则清除占用标记
+ * 
+ * QoS2 报文先记录等待 PUBCOMP 的处理器、再摘下等待 PUBREC 的处理器，期间 ID 一直被占用。
+ * 等待 PUBREL 的处理器使用的是服务器分配的报文 ID，不参与本端的分配。
+ * 
+ * @note 调用前必须持有 mqtt_write_lock。
+ */
+static void mqtt_packet_id_release(mqtt_client_t *c, int type, uint16_t packet_id)
+{
+    if ((PUBREL == type) || (NULL != mqtt_ack_list_find(c, PUBREC, packet_id)) || (NULL != mqtt_ack_list_find(c, PUBCOMP, packet_id)))
+        return;
     
-    return 0;
+    c->mqtt_packet_id_map[packet_id >> 5] &= ~(1u << (packet_id & 31));
+}
+
+/**
+ * @brief 从 ACK 列表中取出指定的 ACK 处理器
+ * 
+ * 取出的处理器已不在列表中，由调用者在释放 mqtt_write_lock 之后调用回调并释放内存。
+ * 只有收到响应时才会取出 ACK 处理器，取出时顺便测量往返时间。
+ * 
+ * @param[in] c         指向 MQTT 客户端实例的指针
+ * @param[in] type      报文类型
+ * @param[in] packet_id 报文 ID
+ * @return 取出的 ACK 处理器，不存在时返回 NULL
+ * 
+ * @note 调用前必须持有 mqtt_write_lock。
+ */
+static ack_handlers_t *mqtt_ack_list_take(mqtt_client_t* c, int type, uint16_t packet_id)
+{
+    ack_handlers_t *ack_handler = mqtt_ack_list_find(c, type, packet_id);
+
+    if (NULL != ack_handler) {
+        mqtt_ack_handler_measure(c, ack_handler);
+        mqtt_ack_list_remove(c, ack_handler);
+    }
+
+    return ack_handler;
+}
+
+/**
+ * @brief 调用 ACK 处理器上的异步发布完成回调
+ * 
+ * 回调只会被调用一次，调用后即从 ACK 处理器上清除。
+ * 
+ * @param[in] c           指向 MQTT 客户端实例的指针
+ * @param[in] ack_handler ACK 处理器，可为 NULL
+ * @param[in] result      发布结果，MQTT_SUCCESS_ERROR 表示已被服务器确认
+ */
+static void mqtt_ack_handler_complete(mqtt_client_t* c, ack_handlers_t* ack_handler, int result)
+{
+    publish_handler_t handler;
+
+    if ((NULL == ack_handler) || (NULL == ack_handler->publish_handler))
+        return;
+
+    handler = ack_handler->publish_handler;
+    ack_handler->publish_handler = NULL;
+    handler(c, ack_handler->publish_arg, result);
+}
+
+/**
+ * @brief 检查 ACK 列表中是否存在指定节点
+ * 
+ * 对于 QoS1 和 QoS2 的 MQTT 报文，可以使用报文 ID 和类型作为唯一标识符，
+ * 判断节点是否已存在，避免重复添加。
+ * 
+ * @param[in] c         指向 MQTT 客户端实例的指针
+ * @param[in] type      报文类型
+ * @param[in] packet_id 报文 ID
+ * @return 1: 存在, 0: 不存在
+ */
+static int mqtt_ack_list_node_is_exist(mqtt_client_t* c, int type, uint16_t packet_id)
+{
+    /* 对于 QoS1 和 QoS2 的 MQTT 报文，可以使用报文 ID 和类型作为唯一
+       标识符来判断节点是否已存在，避免重复添加。 */
+    return (NULL != mqtt_ack_list_find(c, type, packet_id)) ? 1 : 0;
 }
 
 /**
@@ -634,14 +1383,20 @@ static int mqtt_ack_list_node_is_exist(mqtt_client_t* c, int type, uint16_t pack
  * @param[in] c           指向 MQTT 客户端实例的指针
  * @param[in] type        报文类型
  * @param[in] packet_id   报文 ID
- * @param[in] payload_len 负载长度
+ * @param[in] payload_len 写缓冲区中需要保存的报文长度
+ * @param[in] tail        紧跟在写缓冲区数据之后的报文数据（PUBLISH 负载），可为 NULL
+ * @param[in] tail_len    tail 的长度
  * @param[in] handler     消息处理器
  * @return 
  *   - MQTT_SUCCESS_ERROR: 记录成功
  *   - MQTT_ACK_NODE_IS_EXIST_ERROR: 节点已存在
  *   - MQTT_MEM_NOT_ENOUGH_ERROR: 内存不足
+ * 
+ * @note 调用前必须持有 mqtt_write_lock，收到响应的线程同样要先获取这把锁，
+ *       所以先发送报文、后记录 ACK 处理器不会错过响应。
  */
-static int mqtt_ack_list_record(mqtt_client_t* c, int type, uint16_t packet_id, uint16_t payload_len, message_handlers_t* handler)
+static int mqtt_ack_list_record(mqtt_client_t* c, int type, uint16_t packet_id, uint32_t payload_len, 
+                                const uint8_t *tail, uint32_t tail_len, message_handlers_t* handler)
 {
     int rc = MQTT_SUCCESS_ERROR;
     ack_handlers_t *ack_handler = NULL;
@@ -651,145 +1406,434 @@ static int mqtt_ack_list_record(mqtt_client_t* c, int type, uint16_t packet_id,
         RETURN_ERROR(MQTT_ACK_NODE_IS_EXIST_ERROR);
 
     /* 创建 ACK 处理器节点 */
-    ack_handler = mqtt_ack_handler_create(c, type, packet_id, payload_len, handler);
+    ack_handler = mqtt_ack_handler_create(c, type, packet_id, payload_len, tail, tail_len, handler);
     if (NULL == ack_handler)
         RETURN_ERROR(MQTT_MEM_NOT_ENOUGH_ERROR);
 
-    mqtt_add_ack_handler_num(c);
+    mqtt_add_ack_handler_num(c);
+
+    mqtt_list_add_tail(&ack_handler->list, &c->mqtt_ack_handler_list);
+    mqtt_list_add_tail(&ack_handler->hash, mqtt_ack_hash_bucket(c, packet_id));
+    mqtt_ack_handler_arm(c, ack_handler);   /* 超时时间内无响应将被销毁或重发 */
+
+    if (PUBREL != type)
+        mqtt_packet_id_mark(c, packet_id);  /* 确认之前不再分配这个报文 ID */
+
+    RETURN_ERROR(rc);
+}
+
+/**
+ * @brief 从 ACK 列表中删除记录
+ * 
+ * @param[in]  c          指向 MQTT 客户端实例的指针
+ * @param[in]  type       报文类型
+ * @param[in]  packet_id  报文 ID
+ * @param[out] handler    返回的消息处理器（可选）
+ * @return 
+ *   - MQTT_SUCCESS_ERROR: 删除成功
+ * 
+ * @note 调用前必须持有 mqtt_write_lock。
+ */
+static int mqtt_ack_list_unrecord(mqtt_client_t* c, int type, uint16_t packet_id, message_handlers_t **handler)
+{
+    ack_handlers_t *ack_handler = mqtt_ack_list_take(c, type, packet_id);
+
+    if (NULL == ack_handler)
+        RETURN_ERROR(MQTT_SUCCESS_ERROR);
+
+    if (handler)
+        *handler = ack_handler->handler;
+    
+    /* 释放 ACK 处理器节点 */
+    MQTT_OBJECT_FREE(c, ack_handler);
+
+    RETURN_ERROR(MQTT_SUCCESS_ERROR);
+}
+
+/**
+ * @brief 创建消息处理器
+ * 
+ * @param[in] topic_filter  主题过滤器
+ * @param[in] qos           QoS 级别
+ * @param[in] handler       消息回调函数
+ * @return 创建的消息处理器，失败时返回 NULL
+ */
+static message_handlers_t *mqtt_msg_handler_create(mqtt_client_t* c, const char* topic_filter, mqtt_qos_t qos, message_handler_t handler)
+{
+    message_handlers_t *msg_handler = NULL;
+
+    msg_handler = (message_handlers_t *) MQTT_OBJECT_ALLOC(c, sizeof(message_handlers_t));
+    if (NULL == msg_handler)
+        return NULL;
+    
+    mqtt_list_init(&msg_handler->list);
+    
+    msg_handler->qos = qos;
+    msg_handler->handler = handler;     /* 注册回调处理器 */
+    msg_handler->topic_filter = topic_filter;
+
+    return msg_handler;
+}
+
+/**
+ * @brief 销毁消息处理器
+ * 
+ * 已安装的处理器同时从主题树中删除。
+ * 
+ * @param[in] c           指向 MQTT 客户端实例的指针
+ * @param[in] msg_handler 要销毁的消息处理器
+ */
+static void mqtt_msg_handler_destory(mqtt_client_t* c, message_handlers_t *msg_handler)
+{
+    if (NULL != msg_handler) {
+        mqtt_topic_tree_remove(&c->mqtt_msg_handler_tree, msg_handler->topic_filter, msg_handler);
+        mqtt_list_del(&msg_handler->list);
+        MQTT_OBJECT_FREE(c, msg_handler);
+    }
+}
+
+/**
+ * @brief 销毁 ACK 处理器关联的、尚未安装或等待取消订阅的消息处理器
+ * 
+ * SUBACK 的 ACK 处理器中保存的是本次订阅创建的消息处理器指针数组，UNSUBACK 的是要取消的消息处理器。
+ * 
+ * @param[in] c           指向 MQTT 客户端实例的指针
+ * @param[in] ack_handler 超时或会话被清除的 ACK 处理器
+ */
+static void mqtt_ack_handler_drop_msg_handlers(mqtt_client_t* c, ack_handlers_t* ack_handler)
+{
+    uint32_t i;
+    message_handlers_t **handlers;
+
+    if (SUBACK == ack_handler->type) {
+        handlers = (message_handlers_t **)ack_handler->payload;
+        for (i = 0; i < ack_handler->payload_len / sizeof(message_handlers_t *); i++)
+            mqtt_msg_handler_destory(c, handlers[i]);
+        ack_handler->payload_len = 0;
+    } else if (NULL != ack_handler->handler) {
+        mqtt_msg_handler_destory(c, ack_handler->handler);
+        ack_handler->handler = NULL;
+    }
+}
+
+/**
+ * @brief 安装消息处理器
+ * 
+ * @param[in] c       指向 MQTT 客户端实例的指针
+ * @param[in] handler 要安装的消息处理器
+ * @return 
+ *   - MQTT_SUCCESS_ERROR: 安装成功
+ *   - MQTT_NULL_VALUE_ERROR: 参数为空
+ */
+static int mqtt_msg_handlers_install(mqtt_client_t* c, message_handlers_t *handler)
+{
+    int rc;
+
+    if ((NULL == c) || (NULL == handler))
+        RETURN_ERROR(MQTT_NULL_VALUE_ERROR);
+    
+    /* 通过 MQTT 主题判断节点是否已存在，通配符按普通字符比较 */
+    if (NULL != mqtt_topic_tree_find(&c->mqtt_msg_handler_tree, handler->topic_filter)) {
+        MQTT_LOG_W("%s:%d %s()...topic_filter: %s is already subscribed", __FILE__, __LINE__, __FUNCTION__, handler->topic_filter);
+        mqtt_msg_handler_destory(c, handler);
+        RETURN_ERROR(MQTT_SUCCESS_ERROR);
+    }
+
+    /* 安装到主题树和消息处理器列表 */
+    rc = mqtt_topic_tree_insert(&c->mqtt_msg_handler_tree, handler->topic_filter, handler);
+    if (MQTT_SUCCESS_ERROR != rc) {
+        mqtt_msg_handler_destory(c, handler);
+        RETURN_ERROR(rc);
+    }
+
+    mqtt_list_add_tail(&handler->list, &c->mqtt_msg_handler_list);
+
+    RETURN_ERROR(MQTT_SUCCESS_ERROR);
+}
+
+/**
+ * @brief 等待发送窗口空出位置
+ * 
+ * 窗口已满时登记为等待者并释放写锁，让收到的 ACK 得以处理，然后在 mqtt_inflight_sem 上阻塞，
+ * 每确认一个报文唤醒一个等待者，连接断开时唤醒全部等待者，直到窗口有空位、等待超时或连接断开。
+ * 调用前和返回时都持有 mqtt_write_lock。
+ * 
+ * @param[in] c        指向 MQTT 客户端实例的指针
+ * @param[in] timeout  最多等待的时间（毫秒），0 表示不等待
+ * @return 
+ *   - MQTT_SUCCESS_ERROR: 窗口有空位
+ *   - MQTT_ACK_HANDLER_NUM_TOO_MUCH_ERROR: 窗口已满且等待超时，稍后重试即可
+ *   - MQTT_NOT_CONNECT_ERROR: 等待期间连接断开
+ * 
+ * @note ACK 由 mqtt_yield_thread（或事件循环）处理，在消息回调中发布时不要设置等待时间。
+ */
+static int mqtt_inflight_wait(mqtt_client_t* c, uint32_t timeout)
+{
+    int full;
+    platform_timer_t timer;
+
+    if (!mqtt_ack_handler_is_maximum(c))
+        RETURN_ERROR(MQTT_SUCCESS_ERROR);
+
+    platform_timer_init(&timer);
+    platform_timer_cutdown(&timer, timeout);
+
+    while (1) {
+        /* 检查窗口和登记等待在同一次加锁中完成，之后的确认一定会看到这个等待者，唤醒不会丢失 */
+        platform_mutex_lock(&c->mqtt_global_lock);
+        full = mqtt_ack_handler_is_maximum(c);
+        if (full)
+            c->mqtt_inflight_waiters++;
+        platform_mutex_unlock(&c->mqtt_global_lock);
+
+        if (!full)
+            break;
+
+        if ((0 == timeout) || platform_timer_is_expired(&timer)) {
+            platform_mutex_lock(&c->mqtt_global_lock);
+            c->mqtt_inflight_waiters--;
+            platform_mutex_unlock(&c->mqtt_global_lock);
+            RETURN_ERROR(MQTT_ACK_HANDLER_NUM_TOO_MUCH_ERROR);
+        }
+
+        platform_mutex_unlock(&c->mqtt_write_lock);
+        platform_sem_wait(&c->mqtt_inflight_sem, platform_timer_remain(&timer));
+        platform_mutex_lock(&c->mqtt_write_lock);
+
+        platform_mutex_lock(&c->mqtt_global_lock);
+        c->mqtt_inflight_waiters--;
+        platform_mutex_unlock(&c->mqtt_global_lock);
+
+        if (CLIENT_STATE_CONNECTED != mqtt_get_client_state(c))
+            RETURN_ERROR(MQTT_NOT_CONNECT_ERROR);
+    }
+
+    RETURN_ERROR(MQTT_SUCCESS_ERROR);
+}
+
+/**
+ * @brief 按模板把 PUBLISH 报头写入写缓冲区
+ * 
+ * 模板中已经缓存了固定报头的第一个字节和编码后的主题，这里只写入剩余长度和报文 ID。
+ * 
+ * @param[in] c    指向 MQTT 客户端实例的指针
+ * @param[in] tpl  报头模板
+ * @param[in] msg  消息，使用其中的报文 ID 和负载长度
+ * @return 报头长度，写缓冲区放不下时返回 MQTTPACKET_BUFFER_TOO_SHORT
+ */
+static int mqtt_publish_template_serialize(mqtt_client_t* c, const mqtt_publish_template_t* tpl, mqtt_message_t* msg)
+{
+    int rem_len;
+    unsigned char *ptr = c->mqtt_write_buf;
+
+    rem_len = tpl->topic_len + ((QOS0 != tpl->qos) ? 2 : 0) + msg->payloadlen;
+    if ((uint32_t)(MQTTPacket_len(rem_len) - msg->payloadlen) > c->mqtt_write_buf_size)
+        return MQTTPACKET_BUFFER_TOO_SHORT;
 
-    mqtt_list_add_tail(&ack_handler->list, &c->mqtt_ack_handler_list);
+    *ptr++ = tpl->flags;
+    ptr += MQTTPacket_encode(ptr, rem_len);     /* 剩余长度 */
+    memcpy(ptr, tpl->topic, tpl->topic_len);
+    ptr += tpl->topic_len;
+    if (QOS0 != tpl->qos)
+        writeInt(&ptr, msg->id);                /* 报文 ID */
 
-    RETURN_ERROR(rc);
+    return (int)(ptr - c->mqtt_write_buf);
 }
 
 /**
- * @brief 从 ACK 列表中删除记录
+ * @brief 发送一条 PUBLISH 报文
  * 
- * @param[in]  c          指向 MQTT 客户端实例的指针
- * @param[in]  type       报文类型
- * @param[in]  packet_id  报文 ID
- * @param[out] handler    返回的消息处理器（可选）
+ * mqtt_publish() 与异步发布队列共用的发送流程：在写锁内序列化报头、分散发送报头与负载，
+ * QoS1/QoS2 消息记录 ACK 处理器（连同完成回调）以便重传。
+ * 
+ * @param[in] c             指向 MQTT 客户端实例的指针
+ * @param[in] topic_filter  主题（tpl 不为 NULL 时不使用）
+ * @param[in] tpl           报头模板，不为 NULL 时按模板生成报头
+ * @param[in] msg           消息，QoS1/QoS2 时 msg->id 会被设置为分配的报文 ID
+ * @param[in] handler       QoS1/QoS2 的完成回调，可为 NULL
+ * @param[in] arg           传递给完成回调的用户参数
+ * @param[in] timeout       发送窗口已满时最多等待的时间（毫秒），0 表示不等待
  * @return 
- *   - MQTT_SUCCESS_ERROR: 删除成功
+ *   - MQTT_SUCCESS_ERROR: 发送成功
+ *   - 其他错误码: 发送失败，此时不会调用 handler
  */
-static int mqtt_ack_list_unrecord(mqtt_client_t* c, int type, uint16_t packet_id, message_handlers_t **handler)
+static int mqtt_publish_packet(mqtt_client_t* c, const char* topic_filter, const mqtt_publish_template_t* tpl, mqtt_message_t* msg, 
+                               publish_handler_t handler, void* arg, uint32_t timeout)
 {
-    mqtt_list_t *curr, *next;
+    int len = 0;                    // 序列化后的报头长度
+    int rc = MQTT_FAILED_ERROR;     // 返回码，初始化为失败
+    platform_timer_t timer;         // 用于超时控制的定时器
+    mqtt_iovec_t iov[2];            // 报头 + 负载
     ack_handlers_t *ack_handler;
+    MQTTString topic = MQTTString_initializer;  // MQTT 字符串结构体，用于序列化
+    topic.cstring = (char *)topic_filter;       // 设置主题字符串
 
-    if (mqtt_list_is_empty(&c->mqtt_ack_handler_list))
-        RETURN_ERROR(MQTT_SUCCESS_ERROR);
+#ifdef MQTT_USING_WRITER_THREAD
+    // QoS0 报文直接交给写线程，不经过写缓冲区和写锁
+    if ((NULL == tpl) && (QOS0 == msg->qos) && mqtt_writer_is_running(c))
+        return mqtt_writer_publish(c, topic, msg);
+#endif
 
-    LIST_FOR_EACH_SAFE(curr, next, &c->mqtt_ack_handler_list) {
-        ack_handler = LIST_ENTRY(curr, ack_handlers_t, list);
+    // 加锁，防止多线程并发写入网络缓冲区
+    platform_mutex_lock(&c->mqtt_write_lock);
 
-        if ((packet_id != ack_handler->packet_id) || (type != ack_handler->type))
-            continue;
+    // 对于 QoS > 0 的消息，需要记录 ACK 处理器以便重传
+    if (QOS0 != msg->qos) {
+        // 待确认的消息数量已达上限时，在超时时间内等待 ACK 腾出位置
+        if ((rc = mqtt_inflight_wait(c, timeout)) != MQTT_SUCCESS_ERROR)
+            goto exit; // 跳转至清理和解锁
+        // 获取下一个可用的报文 ID（用于 QoS1/QoS2 的消息匹配）
+        if (0 == (msg->id = mqtt_get_next_packet_id(c))) {
+            rc = MQTT_ACK_HANDLER_NUM_TOO_MUCH_ERROR;
+            goto exit;
+        }
+    }
+    
+    /* 只序列化 PUBLISH 报头到写缓冲区，负载稍后直接发送 */
+    if (NULL != tpl)
+        len = mqtt_publish_template_serialize(c, tpl, msg);
+    else
+        len = MQTTSerialize_publishHeader(
+                  c->mqtt_write_buf,      // 输出缓冲区
+                  c->mqtt_write_buf_size, // 缓冲区大小
+                  0,                      // dup 标志（初始为 0，后面可能设置）
+                  msg->qos,               // QoS 级别
+                  msg->retained,          // retain 标志
+                  msg->id,                // 报文 ID（QoS0 可为 0）
+                  topic,                  // 主题
+                  msg->payloadlen         // 负载长度
+              );
 
-        if (handler)
-            *handler = ack_handler->handler;
-        
-        /* 销毁 ACK 处理器节点 */
-        mqtt_ack_handler_destroy(ack_handler);
-        mqtt_subtract_ack_handler_num(c);
+    // 序列化失败（返回值 <= 0），直接跳转退出
+    if (len <= 0) {
+        rc = MQTT_BUFFER_TOO_SHORT_ERROR;
+        goto exit;
     }
-    RETURN_ERROR(MQTT_SUCCESS_ERROR);
-}
+    
+    // 报头和负载一次分散写出
+    iov[0].buf = c->mqtt_write_buf;
+    iov[0].len = len;
+    iov[1].buf = (unsigned char *)msg->payload;
+    iov[1].len = (int)msg->payloadlen;
+    if ((rc = mqtt_send_packet_iov(c, iov, 2, &timer)) != MQTT_SUCCESS_ERROR)
+        goto exit; // 发送失败，跳转退出
+    
+    // 如果是 QoS1 或 QoS2，需要等待对方确认，并准备重传机制
+    if (QOS0 != msg->qos) {
+        int type = (QOS1 == msg->qos) ? PUBACK : PUBREC;
 
-/**
- * @brief 创建消息处理器
- * 
- * @param[in] topic_filter  主题过滤器
- * @param[in] qos           QoS 级别
- * @param[in] handler       消息回调函数
- * @return 创建的消息处理器，失败时返回 NULL
- */
-static message_handlers_t *mqtt_msg_handler_create(const char* topic_filter, mqtt_qos_t qos, message_handler_t handler)
-{
-    message_handlers_t *msg_handler = NULL;
+        mqtt_set_publish_dup(c, 1);  /* 设置 DUP 标志，表示此消息可能重发 */
 
-    msg_handler = (message_handlers_t *) platform_memory_alloc(sizeof(message_handlers_t));
-    if (NULL == msg_handler)
-        return NULL;
-    
-    mqtt_list_init(&msg_handler->list);
+        /* QoS1 期望收到 PUBACK，QoS2 期望收到 PUBREC，否则将重发 */
+        rc = mqtt_ack_list_record(c, type, msg->id, len, (uint8_t *)msg->payload, msg->payloadlen, NULL);
+        
+        if ((MQTT_SUCCESS_ERROR == rc) && (NULL != handler)) {
+            ack_handler = mqtt_ack_list_find(c, type, msg->id);
+            ack_handler->publish_handler = handler;
+            ack_handler->publish_arg = arg;
+        }
+    }
     
-    msg_handler->qos = qos;
-    msg_handler->handler = handler;     /* 注册回调处理器 */
-    msg_handler->topic_filter = topic_filter;
+exit:
+    platform_mutex_unlock(&c->mqtt_write_lock); // 释放写锁
 
-    return msg_handler;
+    RETURN_ERROR(rc);
 }
 
+#ifdef MQTT_USING_PUBLISH_ASYNC
+
 /**
- * @brief 销毁消息处理器
+ * @brief 清空异步发布队列
  * 
- * @param[in] msg_handler 要销毁的消息处理器
+ * 以 result 调用每个请求的完成回调后释放请求。
+ * 
+ * @param[in] c       指向 MQTT 客户端实例的指针
+ * @param[in] result  传递给完成回调的结果
  */
-static void mqtt_msg_handler_destory(message_handlers_t *msg_handler)
+static void mqtt_publish_queue_clear(mqtt_client_t* c, int result)
 {
-    if (NULL != &msg_handler->list) {
-        mqtt_list_del(&msg_handler->list);
-        platform_memory_free(msg_handler);
+    mqtt_list_t queue;
+    mqtt_list_t *curr, *next;
+    mqtt_publish_request_t *req;
+
+    /* 先整体摘下队列，回调在锁外执行 */
+    mqtt_list_init(&queue);
+    platform_mutex_lock(&c->mqtt_publish_queue_lock);
+    if (!mqtt_list_is_empty(&c->mqtt_publish_queue)) {
+        queue.next = c->mqtt_publish_queue.next;
+        queue.prev = c->mqtt_publish_queue.prev;
+        queue.next->prev = &queue;
+        queue.prev->next = &queue;
+        mqtt_list_init(&c->mqtt_publish_queue);
+    }
+    c->mqtt_publish_queue_number = 0;
+    platform_mutex_unlock(&c->mqtt_publish_queue_lock);
+
+    LIST_FOR_EACH_SAFE(curr, next, &queue) {
+        req = LIST_ENTRY(curr, mqtt_publish_request_t, list);
+        mqtt_list_del(&req->list);
+        if (NULL != req->handler)
+            req->handler(c, req->arg, result);
+        MQTT_OBJECT_FREE(c, req);
     }
 }
 
 /**
- * @brief 检查消息处理器是否已存在
+ * @brief 发送异步发布队列中的消息
  * 
- * 通过 MQTT 主题判断节点是否已存在，但不支持通配符。
+ * 由 mqtt_yield_thread（或事件循环）调用，按入队顺序逐个发送。未连接时不发送，
+ * 请求留在队列中等待重连；发送途中连接断开时，当前请求放回队首，不会丢失也不会乱序。
+ * 待确认的 QoS1/QoS2 消息达到上限时暂停发送，等收到 ACK 后再继续，不在这里等待。
  * 
- * @param[in] c       指向 MQTT 客户端实例的指针
- * @param[in] handler 要检查的消息处理器
- * @return 1: 存在, 0: 不存在
+ * @param[in] c  指向 MQTT 客户端实例的指针
+ * @return 本次发送的消息数
  */
-static int mqtt_msg_handler_is_exist(mqtt_client_t* c, message_handlers_t *handler)
+static int mqtt_publish_queue_flush(mqtt_client_t* c)
 {
-    mqtt_list_t *curr, *next;
-    message_handlers_t *msg_handler;
+    int rc, sent = 0;
+    mqtt_publish_request_t *req;
 
-    if (mqtt_list_is_empty(&c->mqtt_msg_handler_list))
-        return 0;
+    while (CLIENT_STATE_CONNECTED == mqtt_get_client_state(c)) {
+        platform_mutex_lock(&c->mqtt_publish_queue_lock);
+        if (mqtt_list_is_empty(&c->mqtt_publish_queue)) {
+            platform_mutex_unlock(&c->mqtt_publish_queue_lock);
+            break;
+        }
 
-    LIST_FOR_EACH_SAFE(curr, next, &c->mqtt_msg_handler_list) {
-        msg_handler = LIST_ENTRY(curr, message_handlers_t, list);
+        req = LIST_FIRST_ENTRY(&c->mqtt_publish_queue, mqtt_publish_request_t, list);
+        if ((QOS0 != req->message.qos) && mqtt_ack_handler_is_maximum(c)) {
+            platform_mutex_unlock(&c->mqtt_publish_queue_lock);
+            break;
+        }
 
-        /* 通过 MQTT 主题判断节点是否已存在，但不支持通配符 */
-        if ((NULL != msg_handler->topic_filter) && (mqtt_is_topic_equals(msg_handler->topic_filter, handler->topic_filter))) {
-            MQTT_LOG_W("%s:%d %s()...msg_handler->topic_filter: %s, handler->topic_filter: %s", 
-                        __FILE__, __LINE__, __FUNCTION__, msg_handler->topic_filter, handler->topic_filter);
-            return 1;
+        mqtt_list_del(&req->list);
+        c->mqtt_publish_queue_number--;
+        platform_mutex_unlock(&c->mqtt_publish_queue_lock);
+
+        rc = mqtt_publish_packet(c, req->topic, NULL, &req->message, req->handler, req->arg, 0);
+
+        /* 连接在发送途中断开（或写队列已满），请求放回队首，重连后按原顺序重新发送 */
+        if ((MQTT_NOT_CONNECT_ERROR == rc) || (MQTT_SEND_PACKET_ERROR == rc)) {
+            platform_mutex_lock(&c->mqtt_publish_queue_lock);
+            mqtt_list_add(&req->list, &c->mqtt_publish_queue);
+            c->mqtt_publish_queue_number++;
+            platform_mutex_unlock(&c->mqtt_publish_queue_lock);
+            break;
         }
-    }
-    
-    return 0;
-}
 
-/**
- * @brief 安装消息处理器
- * 
- * @param[in] c       指向 MQTT 客户端实例的指针
- * @param[in] handler 要安装的消息处理器
- * @return 
- *   - MQTT_SUCCESS_ERROR: 安装成功
- *   - MQTT_NULL_VALUE_ERROR: 参数为空
- */
-static int mqtt_msg_handlers_install(mqtt_client_t* c, message_handlers_t *handler)
-{
-    if ((NULL == c) || (NULL == handler))
-        RETURN_ERROR(MQTT_NULL_VALUE_ERROR);
-    
-    if (mqtt_msg_handler_is_exist(c, handler)) {
-        mqtt_msg_handler_destory(handler);
-        RETURN_ERROR(MQTT_SUCCESS_ERROR);
-    }
+        /* QoS0 发送完成即结束；QoS1/QoS2 的回调已转交给 ACK 处理器，只有发送失败时才在这里通知 */
+        if ((NULL != req->handler) && ((QOS0 == req->message.qos) || (MQTT_SUCCESS_ERROR != rc)))
+            req->handler(c, req->arg, rc);
 
-    /* 安装到消息处理器列表 */
-    mqtt_list_add_tail(&handler->list, &c->mqtt_msg_handler_list);
+        MQTT_OBJECT_FREE(c, req);
+        sent++;
+    }
 
-    RETURN_ERROR(MQTT_SUCCESS_ERROR);
+    return sent;
 }
 
+#endif /* MQTT_USING_PUBLISH_ASYNC */
+
 /**
  * @brief 清理 MQTT 会话
  * 
@@ -800,25 +1844,36 @@ static int mqtt_msg_handlers_install(mqtt_client_t* c, message_handlers_t *handl
 static void mqtt_clean_session(mqtt_client_t* c)
 {
     mqtt_list_t *curr, *next;
+    mqtt_list_t acks;
     ack_handlers_t *ack_handler;
     message_handlers_t *msg_handler;
+
+#ifdef MQTT_USING_WRITER_THREAD
+    /* 先停止写线程，之后客户端随时可能被 mqtt_release() 释放 */
+    mqtt_writer_stop(c);
+#endif
     
-    /* 释放所有 ack_handler_list 内存 */
-    if (!(mqtt_list_is_empty(&c->mqtt_ack_handler_list))) {
-        LIST_FOR_EACH_SAFE(curr, next, &c->mqtt_ack_handler_list) {
-            ack_handler = LIST_ENTRY(curr, ack_handlers_t, list);
-            mqtt_list_del(&ack_handler->list);
-            //@lchnu, 2020-10-08, 避免在等待 suback/unsuback 时断开 socket...
-            if(NULL != ack_handler->handler) {
-              mqtt_msg_handler_destory(ack_handler->handler);
-              ack_handler->handler = NULL;
-            }
-            platform_memory_free(ack_handler);
-        }
-        mqtt_list_del_init(&c->mqtt_ack_handler_list);
+    /* 在锁内摘下所有 ACK 处理器，完成回调在锁外调用 */
+    mqtt_list_init(&acks);
+    platform_mutex_lock(&c->mqtt_write_lock);
+    LIST_FOR_EACH_SAFE(curr, next, &c->mqtt_ack_handler_list) {
+        ack_handler = LIST_ENTRY(curr, ack_handlers_t, list);
+        mqtt_ack_list_remove(c, ack_handler);
+        mqtt_list_add_tail(&ack_handler->list, &acks);
     }
     /* 需要清理 mqtt_ack_handler_number 值，由 @lchnu 发现的 bug */
     c->mqtt_ack_handler_number = 0;
+    platform_mutex_unlock(&c->mqtt_write_lock);
+
+    /* 释放所有 ack_handler_list 内存 */
+    LIST_FOR_EACH_SAFE(curr, next, &acks) {
+        ack_handler = LIST_ENTRY(curr, ack_handlers_t, list);
+        mqtt_list_del(&ack_handler->list);
+        mqtt_ack_handler_complete(c, ack_handler, MQTT_CLEAN_SESSION_ERROR);
+        //@lchnu, 2020-10-08, 避免在等待 suback/unsuback 时断开 socket...
+        mqtt_ack_handler_drop_msg_handlers(c, ack_handler);
+        MQTT_OBJECT_FREE(c, ack_handler);
+    }
 
     /* 释放所有 msg_handler_list 内存 */
     if (!(mqtt_list_is_empty(&c->mqtt_msg_handler_list))) {
@@ -826,15 +1881,47 @@ static void mqtt_clean_session(mqtt_client_t* c)
             msg_handler = LIST_ENTRY(curr, message_handlers_t, list);
             mqtt_list_del(&msg_handler->list);
             msg_handler->topic_filter = NULL;
-            platform_memory_free(msg_handler);
+            MQTT_OBJECT_FREE(c, msg_handler);
         }
         // MQTT_LOG_D("%s:%d %s() mqtt_msg_handler_list delete", __FILE__, __LINE__, __FUNCTION__);
         mqtt_list_del_init(&c->mqtt_msg_handler_list);
     }
+    mqtt_topic_tree_clear(&c->mqtt_msg_handler_tree);
+
+#ifdef MQTT_USING_PUBLISH_ASYNC
+    /* 丢弃尚未发送的异步发布请求 */
+    mqtt_publish_queue_clear(c, MQTT_CLEAN_SESSION_ERROR);
+#endif
 
     mqtt_set_client_state(c, CLIENT_STATE_INVALID);
 }
 
+/**
+ * @brief 处理一个超时的 ACK 处理器
+ * 
+ * QoS1 和 QoS2 报文被重发并重新计时，SUBACK/UNSUBACK 等其他报文的处理器被销毁。
+ * 
+ * @param[in] c           指向 MQTT 客户端实例的指针
+ * @param[in] ack_handler 超时的 ACK 处理器
+ * 
+ * @note 调用前必须持有 mqtt_write_lock。
+ */
+static void mqtt_ack_handler_timeout(mqtt_client_t* c, ack_handlers_t* ack_handler)
+{
+    if (mqtt_ack_handler_is_resend(ack_handler)) {
+        
+        /* 超时已发生。对于 QoS1 和 QoS2 报文，需要重发它们。 */
+        mqtt_ack_handler_resend(c, ack_handler);
+        return;
+    } else if ((ack_handler->type == SUBACK) || (ack_handler->type == UNSUBACK)) {
+        
+        /*@lchnu, 2020-10-08, 如果 suback/unsuback 超时，销毁处理器内存！*/
+        mqtt_ack_handler_drop_msg_handlers(c, ack_handler);
+    }
+    /* 如果不是 QoS1 或 QoS2 消息，将在每次处理时被销毁 */
+    mqtt_ack_handler_destroy(c, ack_handler);
+}
+
 /**
  * @brief 扫描 ACK 列表，处理超时的报文
  * 
@@ -842,75 +1929,237 @@ static void mqtt_clean_session(mqtt_client_t* c)
  * flag : 0 表示不需要等待超时就立即处理这些报文，通常在重连后立即处理。
  *        1 表示需要等待超时后再处理这些消息，通常在稳定连接中的超时处理。
  * 
+ * flag 为 1 时只从 ACK 时间轮上取出已经到期的处理器，开销与待确认报文的数量无关，
+ * 当前时间使用 mqtt_packet_handle() 刷新的 c->mqtt_now。
+ * 
  * @param[in] c     指向 MQTT 客户端实例的指针
  * @param[in] flag  处理标志（0: 立即处理, 1: 等待超时）
  */
 static void mqtt_ack_list_scan(mqtt_client_t* c, uint8_t flag)
 {
     mqtt_list_t *curr, *next;
-    ack_handlers_t *ack_handler;
+    mqtt_wheel_node_t *node;
+    unsigned long now;
 
-    if ((mqtt_list_is_empty(&c->mqtt_ack_handler_list)) || (CLIENT_STATE_CONNECTED != mqtt_get_client_state(c)))
+    if (CLIENT_STATE_CONNECTED != mqtt_get_client_state(c))
         return;
 
-    LIST_FOR_EACH_SAFE(curr, next, &c->mqtt_ack_handler_list) {
-        ack_handler = LIST_ENTRY(curr, ack_handlers_t, list);
-        
-        if ((!platform_timer_is_expired(&ack_handler->timer)) && (flag == 1))
-            continue;
-        
-        if ((ack_handler->type ==  PUBACK) || (ack_handler->type ==  PUBREC) || (ack_handler->type ==  PUBREL) || (ack_handler->type ==  PUBCOMP)) {
-            
-            /* 超时已发生。对于 QoS1 和 QoS2 报文，需要重发它们。 */
-            mqtt_ack_handler_resend(c, ack_handler);
+    platform_mutex_lock(&c->mqtt_write_lock);
+
+    if (flag == 0) {
+        LIST_FOR_EACH_SAFE(curr, next, &c->mqtt_ack_handler_list)
+            mqtt_ack_handler_timeout(c, LIST_ENTRY(curr, ack_handlers_t, list));
+    } else {
+        /* 重发的报文被重新计时，不会在本次扫描中再次取出 */
+        now = c->mqtt_now;
+        while (NULL != (node = mqtt_wheel_pop(&c->mqtt_ack_wheel, now)))
+            mqtt_ack_handler_timeout(c, CONTAINER_OF_FIELD(node, ack_handlers_t, timer));
+    }
+
+    platform_mutex_unlock(&c->mqtt_write_lock);
+}
+
+/**
+ * @brief 尝试重新订阅所有主题
+ * 
+ * 在重连后重新订阅之前的所有主题。
+ * 
+ * @param[in] c  指向 MQTT 客户端实例的指针
+ * @return 
+ *   - MQTT_SUCCESS_ERROR: 重订阅成功
+ *   - MQTT_RESUBSCRIBE_ERROR: 重订阅失败
+ */
+static int mqtt_try_resubscribe(mqtt_client_t* c)
+{
+    int i, n, rc = MQTT_SUCCESS_ERROR;
+    mqtt_list_t *curr, *first;
+    message_handlers_t *msg_handler;
+    mqtt_subscription_t *subs;
+
+    MQTT_LOG_W("%s:%d %s()... mqtt try resubscribe ...", __FILE__, __LINE__, __FUNCTION__);
+    
+    if (mqtt_list_is_empty(&c->mqtt_msg_handler_list)) {
+        // MQTT_LOG_D("%s:%d %s() mqtt_msg_handler_list is empty", __FILE__, __LINE__, __FUNCTION__);
+        RETURN_ERROR(MQTT_SUCCESS_ERROR);
+    }
+
+    subs = (mqtt_subscription_t *)platform_memory_alloc(sizeof(mqtt_subscription_t) * MQTT_SUBSCRIBE_BATCH_MAX);
+    if (NULL == subs)
+        RETURN_ERROR(MQTT_MEM_NOT_ENOUGH_ERROR);
+
+    /* 已安装的消息处理器按顺序打包进尽量少的 SUBSCRIBE 报文，每个报文只需要一个 ACK 处理器 */
+    first = c->mqtt_msg_handler_list.next;
+    while (first != &c->mqtt_msg_handler_list) {
+        for (i = 0, curr = first; (i < MQTT_SUBSCRIBE_BATCH_MAX) && (curr != &c->mqtt_msg_handler_list); i++, curr = curr->next) {
+            msg_handler = LIST_ENTRY(curr, message_handlers_t, list);
+            subs[i].topic_filter = msg_handler->topic_filter;
+            subs[i].qos = msg_handler->qos;
+            subs[i].handler = msg_handler->handler;
+        }
+
+        n = mqtt_subscribe_frame(c, subs, i, 0);
+        if (n < 0) {
+            rc = MQTT_RESUBSCRIBE_ERROR;
+            break;
+        }
+
+        while (n-- > 0)
+            first = first->next;
+    }
+
+    platform_memory_free(subs);
+
+    RETURN_ERROR(rc);
+}
+
+/**
+ * @brief 端点的延迟评分，越小越优先
+ *
+ * 有 PINGRESP 往返时间时使用往返时间，否则使用连接延迟；还没有测量值的端点评分为 0，会被优先尝试一次。
+ */
+static uint32_t mqtt_endpoint_score(const mqtt_endpoint_t* ep)
+{
+    if (ep->pings > 0)
+        return ep->ping_rtt;
+
+    return (ep->connects > 0) ? ep->connect_rtt : 0;
+}
+
+/**
+ * @brief 选择下一次连接使用的端点
+ *
+ * 在没有被暂停的端点中选择评分最小的一个，评分相同时按添加顺序；所有端点都被暂停时选择最早恢复的一个。
+ *
+ * @note 调用前必须持有 mqtt_global_lock，并且至少配置了一个端点。
+ * @return 端点下标
+ */
+static int mqtt_endpoint_select(mqtt_client_t* c, unsigned long now)
+{
+    uint32_t i;
+    int best = -1, first = 0;
+    mqtt_endpoint_t *ep = c->mqtt_endpoints;
+
+    for (i = 0; i < c->mqtt_endpoint_number; i++) {
+        if (!MQTT_TIME_IS_ELAPSED(now, ep[i].down_until, 0)) {
+            if ((long)(ep[i].down_until - ep[first].down_until) < 0)
+                first = i;
             continue;
-        } else if ((ack_handler->type == SUBACK) || (ack_handler->type == UNSUBACK)) {
-            
-            /*@lchnu, 2020-10-08, 如果 suback/unsuback 超时，销毁处理器内存！*/
-            if (NULL != ack_handler->handler) {
-                mqtt_msg_handler_destory(ack_handler->handler);
-                ack_handler->handler = NULL;
-            }
         }
-        /* 如果不是 QoS1 或 QoS2 消息，将在每次处理时被销毁 */
-        mqtt_ack_handler_destroy(ack_handler);
-        mqtt_subtract_ack_handler_num(c); /*@lchnu, 2020-10-08 */
+        if ((best < 0) || (mqtt_endpoint_score(&ep[i]) < mqtt_endpoint_score(&ep[best])))
+            best = i;
+    }
+
+    return (best >= 0) ? best : first;
+}
+
+/**
+ * @brief 是否还有没有被暂停的端点，有则重连失败后立即切换，不需要退避
+ */
+static int mqtt_endpoint_available(mqtt_client_t* c)
+{
+    uint32_t i;
+    int available = 0;
+    unsigned long now = platform_timer_now();
+
+    platform_mutex_lock(&c->mqtt_global_lock);
+    for (i = 0; i < c->mqtt_endpoint_number; i++) {
+        if (MQTT_TIME_IS_ELAPSED(now, c->mqtt_endpoints[i].down_until, 0)) {
+            available = 1;
+            break;
+        }
+    }
+    platform_mutex_unlock(&c->mqtt_global_lock);
+
+    return available;
+}
+
+/**
+ * @brief 记录端点的一次失败并暂停该端点，暂停时间随连续失败次数加倍
+ *
+ * @note 调用前必须持有 mqtt_global_lock。
+ */
+static void mqtt_endpoint_fail(mqtt_endpoint_t* ep, unsigned long now)
+{
+    uint32_t shift;
+
+    ep->failures++;
+    shift = (ep->failures < 5) ? ep->failures - 1 : 4;
+    ep->down_until = now + ((unsigned long)MQTT_ENDPOINT_RETRY_INTERVAL << shift);
+}
+
+/**
+ * @brief 连接前选择端点，把它设置为客户端的服务器地址
+ *
+ * 上一次连接曾经建立成功时，说明连接是断开的而不是连不上，同样记为该端点的一次失败，
+ * 这样重连会立即切换到其他可用的端点。
+ */
+static void mqtt_endpoint_prepare(mqtt_client_t* c)
+{
+    int index;
+    unsigned long now = platform_timer_now();
+
+    platform_mutex_lock(&c->mqtt_global_lock);
+
+    if (c->mqtt_endpoint_number > 0) {
+        if (c->mqtt_endpoint_live && (c->mqtt_endpoint_current >= 0))
+            mqtt_endpoint_fail(&c->mqtt_endpoints[c->mqtt_endpoint_current], now);
+
+        index = mqtt_endpoint_select(c, now);
+        c->mqtt_endpoint_current = index;
+        c->mqtt_host = c->mqtt_endpoints[index].host;
+        c->mqtt_port = c->mqtt_endpoints[index].port;
+    }
+    c->mqtt_endpoint_live = 0;
+
+    platform_mutex_unlock(&c->mqtt_global_lock);
+}
+
+/**
+ * @brief 记录当前端点的连接结果
+ *
+ * @param[in] c        指向 MQTT 客户端实例的指针
+ * @param[in] rc       连接结果
+ * @param[in] latency  开始建立连接到收到 CONNACK 的时间（毫秒），仅连接成功时有效
+ */
+static void mqtt_endpoint_connected(mqtt_client_t* c, int rc, uint32_t latency)
+{
+    mqtt_endpoint_t *ep;
+
+    platform_mutex_lock(&c->mqtt_global_lock);
+
+    if ((c->mqtt_endpoint_current >= 0) && ((uint32_t)c->mqtt_endpoint_current < c->mqtt_endpoint_number)) {
+        ep = &c->mqtt_endpoints[c->mqtt_endpoint_current];
+        if (MQTT_SUCCESS_ERROR == rc) {
+            ep->connect_rtt = (0 == ep->connects) ? latency : (ep->connect_rtt * 7 + latency) / 8;
+            ep->connects++;
+            ep->failures = 0;
+            ep->down_until = platform_timer_now();
+            c->mqtt_endpoint_live = 1;
+        } else {
+            mqtt_endpoint_fail(ep, platform_timer_now());
+        }
     }
+
+    platform_mutex_unlock(&c->mqtt_global_lock);
 }
 
 /**
- * @brief 尝试重新订阅所有主题
- * 
- * 在重连后重新订阅之前的所有主题。
- * 
- * @param[in] c  指向 MQTT 客户端实例的指针
- * @return 
- *   - MQTT_SUCCESS_ERROR: 重订阅成功
- *   - MQTT_RESUBSCRIBE_ERROR: 重订阅失败
+ * @brief 收到 PINGRESP，记录当前端点的往返时间
  */
-static int mqtt_try_resubscribe(mqtt_client_t* c)
+static void mqtt_endpoint_pinged(mqtt_client_t* c)
 {
-    int rc = MQTT_RESUBSCRIBE_ERROR;
-    mqtt_list_t *curr, *next;
-    message_handlers_t *msg_handler;
-
-    MQTT_LOG_W("%s:%d %s()... mqtt try resubscribe ...", __FILE__, __LINE__, __FUNCTION__);
-    
-    if (mqtt_list_is_empty(&c->mqtt_msg_handler_list)) {
-        // MQTT_LOG_D("%s:%d %s() mqtt_msg_handler_list is empty", __FILE__, __LINE__, __FUNCTION__);
-        RETURN_ERROR(MQTT_SUCCESS_ERROR);
-    }
-    
-    LIST_FOR_EACH_SAFE(curr, next, &c->mqtt_msg_handler_list) {
-        msg_handler = LIST_ENTRY(curr, message_handlers_t, list);
+    uint32_t rtt = (uint32_t)(c->mqtt_now - c->mqtt_ping_sent);
+    mqtt_endpoint_t *ep;
 
-        /* 重新订阅主题 */
-        if ((rc = mqtt_subscribe(c, msg_handler->topic_filter, msg_handler->qos, msg_handler->handler)) == MQTT_ACK_HANDLER_NUM_TOO_MUCH_ERROR)
-            MQTT_LOG_W("%s:%d %s()... mqtt ack handler num too much ...", __FILE__, __LINE__, __FUNCTION__);
+    platform_mutex_lock(&c->mqtt_global_lock);
 
+    if ((c->mqtt_endpoint_current >= 0) && ((uint32_t)c->mqtt_endpoint_current < c->mqtt_endpoint_number)) {
+        ep = &c->mqtt_endpoints[c->mqtt_endpoint_current];
+        ep->ping_rtt = (0 == ep->pings) ? rtt : (ep->ping_rtt * 7 + rtt) / 8;
+        ep->pings++;
     }
 
-    RETURN_ERROR(rc);
+    platform_mutex_unlock(&c->mqtt_global_lock);
 }
 
 /**
@@ -925,13 +2174,19 @@ static int mqtt_try_do_reconnect(mqtt_client_t* c)
 {
     int rc = MQTT_CONNECT_FAILED_ERROR;
 
+    /* 每次只连接一个端点，连接失败时由 mqtt_reconnect_attempt() 决定是否立即切换到下一个端点 */
     if (CLIENT_STATE_CONNECTED != mqtt_get_client_state(c))
-        rc = mqtt_connect(c);       /* 重连 */
+        rc = mqtt_connect_with_results(c);      /* 重连 */
     
     if (MQTT_SUCCESS_ERROR == rc) {
-        rc = mqtt_try_resubscribe(c);   /* 重新订阅 */
-        /* 重连后立即处理这些 ACK 消息 */
+        /* 重连后立即处理这些 ACK 消息（重发未确认的 QoS1/QoS2 报文），之后再重新订阅，避免刚发出的 SUBSCRIBE 被当作超时清除 */
         mqtt_ack_list_scan(c, 0);
+
+        /* 服务器保留了会话时订阅仍然有效，不需要重新订阅 */
+        if ((0 == c->mqtt_clean_session) && (c->mqtt_session_present))
+            MQTT_LOG_D("%s:%d %s()... session present, skip resubscribe", __FILE__, __LINE__, __FUNCTION__);
+        else
+            rc = mqtt_try_resubscribe(c);   /* 重新订阅 */
     }
 
     MQTT_LOG_D("%s:%d %s()... mqtt try connect result is -0x%04x", __FILE__, __LINE__, __FUNCTION__, -rc);
@@ -939,9 +2194,150 @@ static int mqtt_try_do_reconnect(mqtt_client_t* c)
     RETURN_ERROR(rc);
 }
 
+/**
+ * @brief 生成重连抖动使用的伪随机数（xorshift32）
+ *
+ * 第一次使用时播种：random_number() 只取决于时钟且取值范围有限，同时上电的设备很容易得到相同的值，
+ * 因此再混入客户端 ID 的哈希、客户端地址和当前时间，保证不同设备的退避序列互不相关。
+ */
+static uint32_t mqtt_reconnect_random(mqtt_client_t* c)
+{
+    const char *id;
+    uint32_t x = c->mqtt_reconnect_seed;
+
+    if (0 == x) {
+        x = 2166136261u;
+        for (id = c->mqtt_client_id; (NULL != id) && ('\0' != *id); id++)
+            x = (x ^ (uint8_t)*id) * 16777619u;
+        x ^= (uint32_t)random_number() ^ (uint32_t)(uintptr_t)c;
+        x ^= (uint32_t)platform_timer_now() * 2654435761u;
+        if (0 == x)
+            x = 1;
+    }
+
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    c->mqtt_reconnect_seed = x;
+
+    return x;
+}
+
+/**
+ * @brief 在 [min, max] 内均匀取一个随机数
+ */
+static uint32_t mqtt_reconnect_uniform(mqtt_client_t* c, uint32_t min, uint32_t max)
+{
+    if (max <= min)
+        return min;
+
+    return min + (uint32_t)(mqtt_reconnect_random(c) % ((uint64_t)max - min + 1));
+}
+
+/**
+ * @brief 根据重连策略计算重连失败后的等待时间
+ *
+ * 连续失败次数达到熔断阈值时打开熔断器，等待冷却时间；否则按指数退避并加入抖动。
+ *
+ * @note 调用前必须持有 mqtt_global_lock，并且已经累加了连续失败次数。
+ * @return 等待时间（毫秒）
+ */
+static uint32_t mqtt_reconnect_backoff(mqtt_client_t* c)
+{
+    uint32_t n, delay, limit;
+    mqtt_reconnect_policy_t *policy = &c->mqtt_reconnect_policy;
+    mqtt_reconnect_stats_t *stats = &c->mqtt_reconnect_stats;
+    uint32_t cap = (policy->cap > policy->base) ? policy->cap : policy->base;
+
+    if ((0 != policy->breaker_threshold) && (stats->consecutive >= policy->breaker_threshold)) {
+        stats->breaker = MQTT_BREAKER_OPEN;
+        stats->breaker_trips++;
+        /* 冷却时间同样加入抖动，避免同时熔断的设备同时恢复 */
+        return mqtt_reconnect_uniform(c, policy->breaker_cooldown / 2, policy->breaker_cooldown);
+    }
+
+    if (MQTT_BACKOFF_JITTER_DECORRELATED == policy->jitter) {
+        limit = (stats->delay > policy->base) ? stats->delay : policy->base;
+        limit = (limit > cap / 3) ? cap : limit * 3;
+        return mqtt_reconnect_uniform(c, policy->base, limit);
+    }
+
+    /* min(cap, base * 2^(n-1))，逐次翻倍避免溢出 */
+    delay = policy->base;
+    for (n = 1; (n < stats->consecutive) && (delay < cap); n++)
+        delay = (delay > cap / 2) ? cap : delay * 2;
+    if (delay > cap)
+        delay = cap;
+
+    if (MQTT_BACKOFF_JITTER_FULL == policy->jitter)
+        delay = mqtt_reconnect_uniform(c, 0, delay);
+
+    return delay;
+}
+
+/**
+ * @brief 到达重连时间点后执行一次重连，并按结果更新重连统计和下一次重连时间点
+ *
+ * @param[in] c  指向 MQTT 客户端实例的指针
+ * @return
+ *   - MQTT_SUCCESS_ERROR: 重连成功
+ *   - MQTT_RECONNECT_TIMEOUT_ERROR: 还没有到重连时间点（退避或熔断中）
+ *   - 其他: 重连失败
+ */
+static int mqtt_reconnect_attempt(mqtt_client_t* c)
+{
+    int rc, failover;
+    mqtt_reconnect_stats_t *stats = &c->mqtt_reconnect_stats;
+
+    if (!platform_timer_is_expired(&c->mqtt_reconnect_timer))
+        RETURN_ERROR(MQTT_RECONNECT_TIMEOUT_ERROR);
+
+    platform_mutex_lock(&c->mqtt_global_lock);
+    if (MQTT_BREAKER_OPEN == stats->breaker)
+        stats->breaker = MQTT_BREAKER_HALF_OPEN;
+    stats->attempts++;
+    platform_mutex_unlock(&c->mqtt_global_lock);
+
+    /*连接前，调用重连处理器，可用于更新 MQTT 密码，例如：OneNET 平台需要*/
+    if (NULL != c->mqtt_reconnect_handler)
+        c->mqtt_reconnect_handler(c, c->mqtt_reconnect_data);
+
+    rc = mqtt_try_do_reconnect(c);
+
+    /* 还有没有被暂停的端点时立即切换过去，只有所有端点都不可用时才退避 */
+    failover = (MQTT_SUCCESS_ERROR != rc) && mqtt_endpoint_available(c);
+
+    platform_mutex_lock(&c->mqtt_global_lock);
+    if (MQTT_SUCCESS_ERROR == rc) {
+        stats->successes++;
+        stats->consecutive = 0;
+        stats->delay = 0;
+        stats->breaker = MQTT_BREAKER_CLOSED;
+        platform_timer_init(&c->mqtt_reconnect_timer);
+    } else if (failover) {
+        stats->failures++;
+        stats->delay = 0;
+        platform_timer_init(&c->mqtt_reconnect_timer);
+    } else {
+        stats->failures++;
+        stats->consecutive++;
+        stats->delay = mqtt_reconnect_backoff(c);
+        platform_timer_cutdown(&c->mqtt_reconnect_timer, stats->delay);
+    }
+    platform_mutex_unlock(&c->mqtt_global_lock);
+
+    MQTT_LOG_D("%s:%d %s()... reconnect attempt %u result -0x%04x, next delay %u ms", 
+                __FILE__, __LINE__, __FUNCTION__, stats->attempts, -rc, stats->delay);
+
+    RETURN_ERROR(rc);
+}
+
 /**
  * @brief 尝试重连
  * 
+ * 失败后按重连策略休眠到下一次重连时间点。每次最多休眠 base 毫秒并检查客户端状态，
+ * 使 yield 线程能及时响应断开连接和释放客户端。
+ *
  * @param[in] c  指向 MQTT 客户端实例的指针
  * @return 
  *   - MQTT_SUCCESS_ERROR: 重连成功
@@ -949,18 +2345,21 @@ static int mqtt_try_do_reconnect(mqtt_client_t* c)
  */
 static int mqtt_try_reconnect(mqtt_client_t* c)
 {
-    int rc = MQTT_SUCCESS_ERROR;
-
-    /*连接前，调用重连处理器，可用于更新 MQTT 密码，例如：OneNET 平台需要*/
-    if (NULL != c->mqtt_reconnect_handler) {
-        c->mqtt_reconnect_handler(c, c->mqtt_reconnect_data);
-    }
+    int rc;
+    int remain;
+    uint32_t slice;
 
-    rc = mqtt_try_do_reconnect(c);
+    rc = mqtt_reconnect_attempt(c);
 
     if(MQTT_SUCCESS_ERROR != rc) {
-        /*连接失败必须延迟重连尝试持续时间并让 CPU 时间流逝，最低优先级任务可以运行 */
-        mqtt_sleep_ms(c->mqtt_reconnect_try_duration);  
+        /*连接失败必须延迟到下一次重连时间点并让 CPU 时间流逝，最低优先级任务可以运行 */
+        while ((CLIENT_STATE_CLEAN_SESSION != mqtt_get_client_state(c)) && 
+               ((remain = platform_timer_remain(&c->mqtt_reconnect_timer)) > 0)) {
+            slice = c->mqtt_reconnect_policy.base;
+            if ((0 == slice) || ((uint32_t)remain < slice))
+                slice = (uint32_t)remain;
+            mqtt_sleep_ms((int)slice);
+        }
         RETURN_ERROR(MQTT_RECONNECT_TIMEOUT_ERROR);    
     }
     
@@ -994,7 +2393,7 @@ static int mqtt_publish_ack_packet(mqtt_client_t *c, uint16_t packet_id, int pac
     switch (packet_type) {
         case PUBREC:
             len = MQTTSerialize_ack(c->mqtt_write_buf, c->mqtt_write_buf_size, PUBREL, 0, packet_id); /* 创建 PUBREL 确认报文 */
-            rc = mqtt_ack_list_record(c, PUBCOMP, packet_id, len, NULL);   /* 记录 ACK，期望收到 PUBCOMP */
+            rc = mqtt_ack_list_record(c, PUBCOMP, packet_id, len, NULL, 0, NULL);   /* 记录 ACK，期望收到 PUBCOMP */
             if (MQTT_SUCCESS_ERROR != rc)
                 goto exit;
             break;
@@ -1039,16 +2438,25 @@ static int mqtt_puback_and_pubcomp_packet_handle(mqtt_client_t *c, platform_time
     int rc = MQTT_FAILED_ERROR;
     uint16_t packet_id;
     uint8_t dup, packet_type;
+    ack_handlers_t *ack_handler;
 
     rc = mqtt_is_connected(c);
     if (MQTT_SUCCESS_ERROR != rc)
         RETURN_ERROR(rc);
 
-    if (MQTTDeserialize_ack(&packet_type, &dup, &packet_id, c->mqtt_read_buf, c->mqtt_read_buf_size) != 1)
-        rc = MQTT_PUBREC_PACKET_ERROR;
+    if (MQTTDeserialize_ack(&packet_type, &dup, &packet_id, MQTT_READ_FRAME(c), c->mqtt_read_frame_len) != 1)
+        RETURN_ERROR(MQTT_PUBREC_PACKET_ERROR);
     
     (void) dup;
-    rc = mqtt_ack_list_unrecord(c, packet_type, packet_id, NULL);   /* 删除 ACK 处理器记录 */
+    platform_mutex_lock(&c->mqtt_write_lock);
+    ack_handler = mqtt_ack_list_take(c, packet_type, packet_id);    /* 删除 ACK 处理器记录 */
+    platform_mutex_unlock(&c->mqtt_write_lock);
+
+    if (NULL != ack_handler) {
+        /* QoS1 收到 PUBACK、QoS2 收到 PUBCOMP 时发布流程结束，通知异步发布者 */
+        mqtt_ack_handler_complete(c, ack_handler, MQTT_SUCCESS_ERROR);
+        MQTT_OBJECT_FREE(c, ack_handler);
+    }
 
     RETURN_ERROR(rc);
 }
@@ -1056,34 +2464,54 @@ static int mqtt_puback_and_pubcomp_packet_handle(mqtt_client_t *c, platform_time
 static int mqtt_suback_packet_handle(mqtt_client_t *c, platform_timer_t *timer)
 {
     int rc = MQTT_FAILED_ERROR;
-    int count = 0;
-    int granted_qos = 0;
+    int i, count = 0;
+    int granted_qos[MQTT_SUBSCRIBE_BATCH_MAX];
     uint16_t packet_id;
-    int is_nack = 0;
-    message_handlers_t *msg_handler = NULL;
+    uint32_t handler_count;
+    ack_handlers_t *ack_handler;
+    message_handlers_t **handlers;
 
     rc = mqtt_is_connected(c);
     if (MQTT_SUCCESS_ERROR != rc)
         RETURN_ERROR(rc);
 
-    /* deserialize subscribe ack packet */
-    if (MQTTDeserialize_suback(&packet_id, 1, &count, (int*)&granted_qos, c->mqtt_read_buf, c->mqtt_read_buf_size) != 1) 
+    /* deserialize subscribe ack packet, one granted qos per topic filter */
+    if (MQTTDeserialize_suback(&packet_id, MQTT_SUBSCRIBE_BATCH_MAX, &count, granted_qos, MQTT_READ_FRAME(c), c->mqtt_read_frame_len) != 1) 
         RETURN_ERROR(MQTT_SUBSCRIBE_ACK_PACKET_ERROR);
 
-    is_nack = (granted_qos == SUBFAIL);
-    
-    rc = mqtt_ack_list_unrecord(c, SUBACK, packet_id, &msg_handler);
+    platform_mutex_lock(&c->mqtt_write_lock);
+    ack_handler = mqtt_ack_list_take(c, SUBACK, packet_id);
+    platform_mutex_unlock(&c->mqtt_write_lock);
     
-    if (!msg_handler)
+    if (NULL == ack_handler)
         RETURN_ERROR(MQTT_MEM_NOT_ENOUGH_ERROR);
-    
-    if (is_nack) {
-        mqtt_msg_handler_destory(msg_handler);  /* subscribe topic failed, destory message handler */
-        MQTT_LOG_D("subscribe topic failed...");
-        RETURN_ERROR(MQTT_SUBSCRIBE_NOT_ACK_ERROR);
+
+    /* 重新订阅的 ACK 处理器没有消息处理器，按主题顺序与授权结果对应 */
+    handlers = (message_handlers_t **)ack_handler->payload;
+    handler_count = ack_handler->payload_len / sizeof(message_handlers_t *);
+
+    rc = MQTT_SUCCESS_ERROR;
+    for (i = 0; i < count; i++) {
+        granted_qos[i] &= 0xFF;     /* readChar() 返回有符号 char，0x80 会被读成负数 */
+        if (SUBFAIL == granted_qos[i]) {
+            MQTT_LOG_D("subscribe topic failed...");
+            rc = MQTT_SUBSCRIBE_NOT_ACK_ERROR;
+        }
+        
+        if ((uint32_t)i >= handler_count)
+            continue;
+
+        if (SUBFAIL == granted_qos[i])
+            mqtt_msg_handler_destory(c, handlers[i]);  /* subscribe topic failed, destory message handler */
+        else
+            mqtt_msg_handlers_install(c, handlers[i]);
     }
-    
-    rc = mqtt_msg_handlers_install(c, msg_handler);
+
+    /* 服务器返回的授权结果少于主题个数 */
+    for (; (uint32_t)i < handler_count; i++)
+        mqtt_msg_handler_destory(c, handlers[i]);
+
+    MQTT_OBJECT_FREE(c, ack_handler);
     
     RETURN_ERROR(rc);
 }
@@ -1091,29 +2519,74 @@ static int mqtt_suback_packet_handle(mqtt_client_t *c, platform_timer_t *timer)
 static int mqtt_unsuback_packet_handle(mqtt_client_t *c, platform_timer_t *timer)
 {
     int rc = MQTT_FAILED_ERROR;
-    message_handlers_t *msg_handler;
+    message_handlers_t *msg_handler = NULL;
     uint16_t packet_id = 0;
     
     rc = mqtt_is_connected(c);
     if (MQTT_SUCCESS_ERROR != rc)
         RETURN_ERROR(rc);
 
-    if (MQTTDeserialize_unsuback(&packet_id, c->mqtt_read_buf, c->mqtt_read_buf_size) != 1)
+    if (MQTTDeserialize_unsuback(&packet_id, MQTT_READ_FRAME(c), c->mqtt_read_frame_len) != 1)
         RETURN_ERROR(MQTT_UNSUBSCRIBE_ACK_PACKET_ERROR);
 
+    platform_mutex_lock(&c->mqtt_write_lock);
     rc = mqtt_ack_list_unrecord(c, UNSUBACK, packet_id, &msg_handler);  /* unrecord ack handler, and get message handler */
+    platform_mutex_unlock(&c->mqtt_write_lock);
     
     if (!msg_handler)
         RETURN_ERROR(MQTT_MEM_NOT_ENOUGH_ERROR);
     
-    mqtt_msg_handler_destory(msg_handler);  /* destory message handler */
+    mqtt_msg_handler_destory(c, msg_handler);  /* destory message handler */
+
+    RETURN_ERROR(rc);
+}
+
+/**
+ * @brief 回复收到的 PUBLISH 报文
+ * 
+ * QoS1 回复 PUBACK，QoS2 回复 PUBREC，QoS0 不需要回复。
+ * QoS2 消息在同一次持有写锁期间记录等待 PUBREL 的 ACK 处理器（保存刚序列化的 PUBREC 用于重发），
+ * 已有记录说明这是服务器重发的消息。
+ * 
+ * @param[out] duplicate  QoS2 消息已经收到过时为 1，不应再次交给用户
+ * @return 
+ *   - MQTT_SUCCESS_ERROR: 回复成功
+ *   - 其他错误码: 回复失败
+ */
+static int mqtt_publish_reply(mqtt_client_t *c, mqtt_message_t *msg, platform_timer_t *timer, int *duplicate)
+{
+    int len = 0;
+    int rc = MQTT_SUCCESS_ERROR;
+
+    *duplicate = 0;
+
+    /* for qos1 and qos2, you need to send a ack packet */
+    if (msg->qos != QOS0) {
+        platform_mutex_lock(&c->mqtt_write_lock);
+        
+        if (msg->qos == QOS1)
+            len = MQTTSerialize_ack(c->mqtt_write_buf, c->mqtt_write_buf_size, PUBACK, 0, msg->id);
+        else if (msg->qos == QOS2)
+            len = MQTTSerialize_ack(c->mqtt_write_buf, c->mqtt_write_buf_size, PUBREC, 0, msg->id);
+
+        if (len <= 0)
+            rc = MQTT_SERIALIZE_PUBLISH_ACK_PACKET_ERROR;
+        else
+            rc = mqtt_send_packet(c, len, timer);
+
+        /* record the received of a qos2 message and only processes it when the qos2 message is received for the first time */
+        if ((MQTT_SUCCESS_ERROR == rc) && (msg->qos == QOS2))
+            *duplicate = (MQTT_ACK_NODE_IS_EXIST_ERROR == mqtt_ack_list_record(c, PUBREL, msg->id, len, NULL, 0, NULL));
+        
+        platform_mutex_unlock(&c->mqtt_write_lock);
+    }
 
     RETURN_ERROR(rc);
 }
 
 static int mqtt_publish_packet_handle(mqtt_client_t *c, platform_timer_t *timer)
 {
-    int len = 0, rc = MQTT_SUCCESS_ERROR;
+    int duplicate = 0, rc = MQTT_SUCCESS_ERROR;
     MQTTString topic_name;
     mqtt_message_t msg;
     int qos;
@@ -1124,42 +2597,152 @@ static int mqtt_publish_packet_handle(mqtt_client_t *c, platform_timer_t *timer)
         RETURN_ERROR(rc);
 
     if (MQTTDeserialize_publish(&msg.dup, &qos, &msg.retained, &msg.id, &topic_name,
-        (uint8_t**)&msg.payload, (int*)&msg.payloadlen, c->mqtt_read_buf, c->mqtt_read_buf_size) != 1)
+        (uint8_t**)&msg.payload, (int*)&msg.payloadlen, MQTT_READ_FRAME(c), c->mqtt_read_frame_len) != 1)
         RETURN_ERROR(MQTT_PUBLISH_PACKET_ERROR);
     
     msg.qos = (mqtt_qos_t)qos;
 
-    /* for qos1 and qos2, you need to send a ack packet */
-    if (msg.qos != QOS0) {
-        platform_mutex_lock(&c->mqtt_write_lock);
-        
-        if (msg.qos == QOS1)
-            len = MQTTSerialize_ack(c->mqtt_write_buf, c->mqtt_write_buf_size, PUBACK, 0, msg.id);
-        else if (msg.qos == QOS2)
-            len = MQTTSerialize_ack(c->mqtt_write_buf, c->mqtt_write_buf_size, PUBREC, 0, msg.id);
-
-        if (len <= 0)
-            rc = MQTT_SERIALIZE_PUBLISH_ACK_PACKET_ERROR;
-        else
-            rc = mqtt_send_packet(c, len, timer);
-        
-        platform_mutex_unlock(&c->mqtt_write_lock);
-    }
-
+    rc = mqtt_publish_reply(c, &msg, timer, &duplicate);
     if (rc < 0)
         RETURN_ERROR(rc);
 
-    if (msg.qos != QOS2)
+    if (!duplicate)
         mqtt_deliver_message(c, &topic_name, &msg);
-    else {
-        /* record the received of a qos2 message and only processes it when the qos2 message is received for the first time */
-        if ((rc = mqtt_ack_list_record(c, PUBREL, msg.id, len, NULL)) != MQTT_ACK_NODE_IS_EXIST_ERROR)
-            mqtt_deliver_message(c, &topic_name, &msg);
-    }
     
     RETURN_ERROR(rc);
 }
 
+#ifdef MQTT_USING_STREAM_RECEIVE
+
+/**
+ * @brief 开始流式接收超过接收缓冲区大小的 PUBLISH 报文
+ * 
+ * 只要求 PUBLISH 的报头（固定报头、主题、报文 ID）能放进接收缓冲区，解析报头后回调 MQTT_STREAM_BEGIN，
+ * 之后的负载由 mqtt_stream_feed() 逐段交给流式回调。
+ * 
+ * @param[in] c          指向 MQTT 客户端实例的指针
+ * @param[in] frame_len  报文总长度
+ * @return 
+ *   - 1: 已开始流式接收，报头已被消费
+ *   - 0: 报头还没有接收完整
+ *   - MQTT_BUFFER_TOO_SHORT_ERROR: 不能流式接收（不是 PUBLISH 报文、没有设置流式回调或报头过长），应丢弃报文
+ */
+static int mqtt_stream_begin(mqtt_client_t* c, uint32_t frame_len)
+{
+    int qos;
+    uint32_t head_len, avail;
+    MQTTHeader header = {0};
+    MQTTString topic_name;
+    uint8_t *buf = MQTT_READ_FRAME(c);
+    mqtt_message_t *msg = &c->mqtt_stream_message;
+
+    header.byte = buf[0];
+    if ((NULL == c->mqtt_stream_handler) || (PUBLISH != header.bits.type))
+        RETURN_ERROR(MQTT_BUFFER_TOO_SHORT_ERROR);
+
+    /* 报头长度：固定报头（剩余长度字段已由 mqtt_decode_packet 校验） + 主题长度字段 + 主题 + 报文 ID */
+    for (head_len = 1; buf[head_len] & 128; head_len++);
+    head_len += 1 + 2;
+    avail = c->mqtt_read_end - c->mqtt_read_pos;
+    if (avail >= head_len) 
+        head_len += ((buf[head_len - 2] << 8) | buf[head_len - 1]) + ((QOS0 != header.bits.qos) ? 2 : 0);
+
+    if (head_len > c->mqtt_read_buf_size)
+        RETURN_ERROR(MQTT_BUFFER_TOO_SHORT_ERROR);
+
+    if (avail < head_len)
+        return 0;
+
+    msg->payloadlen = 0;
+    if (MQTTDeserialize_publish(&msg->dup, &qos, &msg->retained, &msg->id, &topic_name,
+        (uint8_t**)&msg->payload, (int*)&msg->payloadlen, buf, head_len) != 1)
+        RETURN_ERROR(MQTT_BUFFER_TOO_SHORT_ERROR);
+
+    msg->qos = (mqtt_qos_t)qos;
+    msg->payload = NULL;
+
+    /* 已经收到过的 QoS2 消息（PUBREC 丢失后服务器重发），只接收不回调 */
+    c->mqtt_stream_skip = 0;
+    if (QOS2 == msg->qos) {
+        platform_mutex_lock(&c->mqtt_write_lock);
+        c->mqtt_stream_skip = mqtt_ack_list_node_is_exist(c, PUBREL, msg->id);
+        platform_mutex_unlock(&c->mqtt_write_lock);
+    }
+
+    mqtt_new_message_data(&c->mqtt_stream_data, &topic_name, msg);
+    if (!c->mqtt_stream_skip)
+        c->mqtt_stream_handler(c, &c->mqtt_stream_data, MQTT_STREAM_BEGIN);
+
+    /* 主题所在的缓冲区随后会被负载覆盖 */
+    c->mqtt_stream_data.topic = NULL;
+    c->mqtt_stream_data.topic_len = 0;
+
+    c->mqtt_read_pos += head_len;
+    c->mqtt_read_stream = frame_len - head_len;
+
+    c->mqtt_last_received = c->mqtt_now;
+
+    return 1;
+}
+
+/**
+ * @brief 把接收缓冲区中已缓存的负载交给流式回调
+ * 
+ * 负载接收完毕时回调 MQTT_STREAM_END，并回复 PUBACK/PUBREC。
+ * 
+ * @param[in] c  指向 MQTT 客户端实例的指针
+ */
+static void mqtt_stream_feed(mqtt_client_t* c)
+{
+    int duplicate = 0;
+    platform_timer_t timer;
+    mqtt_message_t *msg = &c->mqtt_stream_message;
+    uint32_t avail = c->mqtt_read_end - c->mqtt_read_pos;
+
+    if (avail > c->mqtt_read_stream)
+        avail = c->mqtt_read_stream;
+
+    if (avail > 0) {
+        msg->payload = MQTT_READ_FRAME(c);
+        msg->payloadlen = avail;
+        if (!c->mqtt_stream_skip)
+            c->mqtt_stream_handler(c, &c->mqtt_stream_data, MQTT_STREAM_CHUNK);
+
+        c->mqtt_read_pos += avail;
+        c->mqtt_read_stream -= avail;
+        c->mqtt_last_received = c->mqtt_now;
+    }
+
+    if (c->mqtt_read_stream > 0)
+        return;
+
+    msg->payload = NULL;
+    msg->payloadlen = 0;
+    if (!c->mqtt_stream_skip)
+        c->mqtt_stream_handler(c, &c->mqtt_stream_data, MQTT_STREAM_END);
+
+    mqtt_publish_reply(c, msg, &timer, &duplicate);
+}
+
+/**
+ * @brief 连接断开时终止未完成的流式接收
+ * 
+ * @param[in] c  指向 MQTT 客户端实例的指针
+ */
+static void mqtt_stream_abort(mqtt_client_t* c)
+{
+    if (0 == c->mqtt_read_stream)
+        return;
+
+    c->mqtt_read_stream = 0;
+    c->mqtt_stream_message.payload = NULL;
+    c->mqtt_stream_message.payloadlen = 0;
+    if (!c->mqtt_stream_skip)
+        c->mqtt_stream_handler(c, &c->mqtt_stream_data, MQTT_STREAM_ABORT);
+}
+
+#endif /* MQTT_USING_STREAM_RECEIVE */
+
 
 static int mqtt_pubrec_and_pubrel_packet_handle(mqtt_client_t *c, platform_timer_t *timer)
 {
@@ -1171,13 +2754,29 @@ static int mqtt_pubrec_and_pubrel_packet_handle(mqtt_client_t *c, platform_timer
     if (MQTT_SUCCESS_ERROR != rc)
         RETURN_ERROR(rc);
 
-    if (MQTTDeserialize_ack(&packet_type, &dup, &packet_id, c->mqtt_read_buf, c->mqtt_read_buf_size) != 1)
+    if (MQTTDeserialize_ack(&packet_type, &dup, &packet_id, MQTT_READ_FRAME(c), c->mqtt_read_frame_len) != 1)
         RETURN_ERROR(MQTT_PUBREC_PACKET_ERROR);
 
     (void) dup;
     rc = mqtt_publish_ack_packet(c, packet_id, packet_type);    /* make a ack packet and send it */
+
+    platform_mutex_lock(&c->mqtt_write_lock);
+
+    if (PUBREC == packet_type) {
+        /* QoS2 的完成回调从等待 PUBREC 的 ACK 处理器转移到等待 PUBCOMP 的 ACK 处理器上 */
+        ack_handlers_t *pubrec = mqtt_ack_list_find(c, PUBREC, packet_id);
+        ack_handlers_t *pubcomp = mqtt_ack_list_find(c, PUBCOMP, packet_id);
+        if ((NULL != pubrec) && (NULL != pubcomp) && (NULL == pubcomp->publish_handler)) {
+            pubcomp->publish_handler = pubrec->publish_handler;
+            pubcomp->publish_arg = pubrec->publish_arg;
+            pubrec->publish_handler = NULL;
+        }
+    }
+
     rc = mqtt_ack_list_unrecord(c, packet_type, packet_id, NULL);
 
+    platform_mutex_unlock(&c->mqtt_write_lock);
+
     RETURN_ERROR(rc);
 }
 
@@ -1206,10 +2805,10 @@ static int mqtt_pubrec_and_pubrel_packet_handle(mqtt_client_t *c, platform_timer
  *   - CONNACK 报文在此函数中被忽略（已在连接阶段处理）
  *   - 若读取时缓冲区太小（MQTT_BUFFER_TOO_SHORT_ERROR），不会立即返回，
  *     而是继续运行，以便后续处理（防止数据丢失）
- *   - 处理完报文后会调用 mqtt_keep_alive() 检查是否需要发送 PINGREQ
+ *   - 处理完报文后会调用 mqtt_keep_alive_check() 检查是否需要发送 PINGREQ
  *   - 返回值为 packet_type 是为了向上传递"已处理的报文类型"，便于调试和状态判断
  *
- * @see mqtt_yield, mqtt_read_packet, mqtt_keep_alive
+ * @see mqtt_yield, mqtt_read_packet, mqtt_keep_alive_check
  *
  * @example
  *   platform_timer_t timer;
@@ -1228,6 +2827,11 @@ static int mqtt_packet_handle(mqtt_client_t* c, platform_timer_t* timer)
     // 如果数据未就绪或正在接收，可能阻塞最多到 timer 超时
     rc = mqtt_read_packet(c, &packet_type, timer);
 
+    /* 每个报文只读取一次时钟，保活、ACK 超时判断都使用这个时间 */
+    c->mqtt_now = platform_timer_now();
+    if (0 != packet_type)
+        c->mqtt_last_received = c->mqtt_now;
+
     // 根据读取到的报文类型进行分发处理
     switch (packet_type) {
         case 0: 
@@ -1303,6 +2907,7 @@ static int mqtt_packet_handle(mqtt_client_t* c, platform_timer_t* timer)
              * 清除 ping 标志，表示保活成功
              */
             c->mqtt_ping_outstanding = 0;    /* keep alive ping success */
+            mqtt_endpoint_pinged(c);
             break;
 
         default:
@@ -1314,7 +2919,7 @@ static int mqtt_packet_handle(mqtt_client_t* c, platform_timer_t* timer)
     }
 
     // 在处理完一个报文后，检查是否需要发送 PINGREQ 以维持连接
-    rc = mqtt_keep_alive(c);
+    rc = mqtt_keep_alive_check(c, c->mqtt_now);
 
 exit:
     // 如果整体处理成功（rc == 0），则返回实际处理的报文类型
@@ -1339,6 +2944,30 @@ static int mqtt_wait_packet(mqtt_client_t* c, int packet_type, platform_timer_t*
     RETURN_ERROR(rc);
 }
 
+/**
+ * @brief 距离下一次保活检查（发送 PINGREQ 或判定 PINGRESP 超时）还有多少毫秒
+ * 
+ * @param[in] c    指向 MQTT 客户端实例的指针
+ * @param[in] now  当前时间（毫秒）
+ * @return 剩余毫秒数，已经到期时返回 0
+ */
+static unsigned long mqtt_keep_alive_remain(mqtt_client_t* c, unsigned long now)
+{
+    long sent, received;
+    unsigned long interval = c->mqtt_keep_alive_interval * 1000;
+
+    if (c->mqtt_ping_outstanding) {
+        sent = (long)(c->mqtt_ping_sent + interval - now);
+    } else {
+        sent = (long)(c->mqtt_last_sent + interval - now);
+        received = (long)(c->mqtt_last_received + interval - now);
+        if (received < sent)
+            sent = received;
+    }
+
+    return (sent > 0) ? (unsigned long)sent : 0;
+}
+
 /**
  * @brief 执行 MQTT 客户端一次"轮询"操作，处理网络 I/O 与协议逻辑
  *
@@ -1381,7 +3010,13 @@ static int mqtt_yield(mqtt_client_t* c, int timeout_ms)
 {
     int rc = MQTT_SUCCESS_ERROR;              // 返回码，初始化为成功
     client_state_t state;                     // 当前客户端状态
-    platform_timer_t timer;                   // 用于控制本次 yield 超时的定时器
+    unsigned long deadline;                   // 本次 yield 的截止时间
+    unsigned long remain;                     // 距离截止时间的毫秒数
+    unsigned long keep_alive;                 // 距离下一次保活检查的毫秒数
+    platform_timer_t tick;                    // 单次读等待的定时器
+#ifdef MQTT_USING_PUBLISH_ASYNC
+    int active;                               // 异步发布队列是否在使用
+#endif
 
     // 参数校验：客户端指针不能为空
     if (NULL == c)
@@ -1391,13 +3026,13 @@ static int mqtt_yield(mqtt_client_t* c, int timeout_ms)
     if (0 == timeout_ms)
         timeout_ms = c->mqtt_cmd_timeout;
 
-    // 初始化定时器
-    platform_timer_init(&timer);
-    // 设置倒计时：从现在起 timeout_ms 毫秒后超时
-    platform_timer_cutdown(&timer, timeout_ms);
+    // 截止时间：从现在起 timeout_ms 毫秒后超时
+    // 之后的当前时间由 mqtt_packet_handle() 每处理一个报文刷新一次，循环中不再单独读取时钟
+    c->mqtt_now = platform_timer_now();
+    deadline = c->mqtt_now + timeout_ms;
     
     // 主循环：在超时时间内持续处理
-    while (!platform_timer_is_expired(&timer)) {
+    while (!MQTT_TIME_IS_ELAPSED(c->mqtt_now, deadline, 0)) {
         // 获取当前客户端状态
         state = mqtt_get_client_state(c);
 
@@ -1415,17 +3050,48 @@ static int mqtt_yield(mqtt_client_t* c, int timeout_ms)
                 RETURN_ERROR(rc);
 
             // 否则继续循环（可能正在重连中）
+            c->mqtt_now = platform_timer_now();
             continue;
         }
         
         /* --- 客户端已连接，处理 MQTT 报文 --- */
 
-        // 调用底层函数处理网络报文（接收、解析、响应）
-        rc = mqtt_packet_handle(c, &timer);
+        remain = deadline - c->mqtt_now;
+        platform_timer_init(&tick);
+        // 读等待不超过下一次保活检查的时间点，空闲时也能按时发送 PINGREQ
+        if (0 != c->mqtt_keep_alive_interval) {
+            keep_alive = mqtt_keep_alive_remain(c, c->mqtt_now);
+            if (keep_alive < remain)
+                remain = keep_alive;
+        }
+#ifdef MQTT_USING_PUBLISH_ASYNC
+        // 先发送异步发布队列中的消息。队列中还有消息或刚发送过消息（正在连续发布）时读等待不超过
+        // MQTT_PUBLISH_QUEUE_TICK，保证新入队的消息及时发出；空闲时不缩短读等待，避免客户端被频繁唤醒，
+        // 此时新入队的第一条消息最迟在本次读等待结束时发出
+        active = mqtt_publish_queue_flush(c);
+        platform_mutex_lock(&c->mqtt_publish_queue_lock);
+        active += c->mqtt_publish_queue_number;
+        platform_mutex_unlock(&c->mqtt_publish_queue_lock);
+        if ((0 != active) && (remain > MQTT_PUBLISH_QUEUE_TICK))
+            remain = MQTT_PUBLISH_QUEUE_TICK;
+#endif
+        platform_timer_cutdown(&tick, remain);
+        // 调用底层函数处理网络报文（接收、解析、响应），并刷新 c->mqtt_now
+        rc = mqtt_packet_handle(c, &tick);
+
+        // 如果处理成功（rc >= 0），说明有报文被处理或无错误
+        if (rc >= 0) {
+            /* 扫描 ACK 列表：处理超时的 QoS 报文（重传或销毁） */
+            mqtt_ack_list_scan(c, 1);
+        } else if (MQTT_NOT_CONNECT_ERROR == rc) {
+            MQTT_LOG_E("%s:%d %s()... mqtt not connect", __FILE__, __LINE__, __FUNCTION__);
+        } else {
+            break;
+        }
+    }
 
-        // 如果处理成功（rc >= 0），说明有报文被处理或无错误
-        if (rc >= 0) {
-            /* 扫描 ACK 列表：处理超时的 QoS 报文（重传或销毁）
+    RETURN_ERROR(rc);
+}
 
 /**
  * @brief MQTT 客户端后台主循环线程函数
@@ -1510,6 +3176,100 @@ exit:
     // 注意：函数返回后，线程结束
 }
 
+#ifdef MQTT_USING_REACTOR
+/**
+ * @brief 事件循环模式下的客户端回调函数
+ *
+ * 代替 mqtt_yield_thread 中的 mqtt_yield() 循环：
+ *   - MQTT_REACTOR_EVENT_READABLE：socket 可读，读取并处理已到达的所有报文，对端关闭连接时由读取函数断开网络
+ *   - MQTT_REACTOR_EVENT_TICK：周期性 tick，处理清除会话、保活与 ACK 超时重传，到达重连时间点时把重连交给工作线程
+ *   - MQTT_REACTOR_EVENT_DEFERRED：在工作线程中执行一次重连，阻塞的连接不影响同一事件循环上的其他客户端
+ *   - MQTT_REACTOR_EVENT_WAKEUP：mqtt_disconnect() 或 mqtt_publish_async() 唤醒，立即清除会话或发送异步发布队列
+ *
+ * @param[in] node   客户端挂载在事件循环上的节点
+ * @param[in] event  事件类型
+ */
+static void mqtt_reactor_handler(mqtt_reactor_node_t *node, int event)
+{
+    int rc;
+    platform_timer_t timer;
+    mqtt_client_t *c = (mqtt_client_t *)node->owner;
+    client_state_t state = mqtt_get_client_state(c);
+
+    if (MQTT_REACTOR_EVENT_DEFERRED == event) {
+        if ((CLIENT_STATE_CONNECTED != state) && (CLIENT_STATE_CLEAN_SESSION != state))
+            mqtt_reconnect_attempt(c);
+        return;
+    }
+
+    if (MQTT_REACTOR_EVENT_READABLE == event) {
+        /* 在 epoll_wait 返回后 socket 已被释放，忽略这个过期的事件 */
+        if ((CLIENT_STATE_CONNECTED != state) || (node->fd != c->mqtt_network->socket))
+            return;
+
+        /* 定时器未设置即已过期，只处理已经到达的数据，处理完缓冲区中的所有完整报文后返回 */
+        do {
+            platform_timer_init(&timer);
+            rc = mqtt_packet_handle(c, &timer);
+        } while ((rc > 0) && (CLIENT_STATE_CONNECTED == mqtt_get_client_state(c)));
+#ifdef MQTT_USING_PUBLISH_ASYNC
+        /* 收到的 ACK 可能释放了发送窗口 */
+        mqtt_publish_queue_flush(c);
+#endif
+        return;
+    }
+
+    /* 唤醒时只处理清除会话和异步发布队列，保活与重传留给 tick */
+    if ((MQTT_REACTOR_EVENT_WAKEUP == event) && (CLIENT_STATE_CLEAN_SESSION != state)) {
+#ifdef MQTT_USING_PUBLISH_ASYNC
+        if (CLIENT_STATE_CONNECTED == state)
+            mqtt_publish_queue_flush(c);
+#endif
+        return;
+    }
+
+    if (CLIENT_STATE_CLEAN_SESSION == state) {
+        MQTT_LOG_W("%s:%d %s()..., mqtt clean session....", __FILE__, __LINE__, __FUNCTION__);
+        /* 必须在 mqtt_clean_session() 之前摘除，之后客户端随时可能被 mqtt_release() 释放 */
+        mqtt_reactor_remove(node);
+        network_disconnect(c->mqtt_network);
+        mqtt_clean_session(c);
+    } else if (CLIENT_STATE_CONNECTED != state) {
+        /* 退避期间直接返回；到达重连时间点后交给工作线程，事件循环不等待连接和 CONNACK */
+        if (platform_timer_is_expired(&c->mqtt_reconnect_timer))
+            mqtt_reactor_defer(node);
+    } else {
+        c->mqtt_now = platform_timer_now();
+        mqtt_keep_alive_check(c, c->mqtt_now);
+        mqtt_ack_list_scan(c, 1);
+#ifdef MQTT_USING_PUBLISH_ASYNC
+        mqtt_publish_queue_flush(c);
+#endif
+    }
+}
+
+/**
+ * @brief 判断客户端是否由事件循环驱动
+ *
+ * 仅 TCP 通道支持事件循环模式：TLS 层内部缓存的已解密数据不会触发 socket 可读事件，
+ * 因此 TLS 客户端仍回退到独立的 mqtt_yield_thread。
+ */
+static int mqtt_reactor_is_used(mqtt_client_t* c)
+{
+    if (NULL == c->mqtt_reactor)
+        return 0;
+
+#ifndef MQTT_NETWORK_TYPE_NO_TLS
+    if (NETWORK_CHANNEL_TLS == c->mqtt_network->channel) {
+        MQTT_LOG_W("%s:%d %s()... the reactor does not support tls, use yield thread...", __FILE__, __LINE__, __FUNCTION__);
+        return 0;
+    }
+#endif
+
+    return 1;
+}
+#endif /* MQTT_USING_REACTOR */
+
 /**
  * @brief 执行 MQTT 连接流程，并等待 CONNACK 响应，返回连接结果
  *
@@ -1549,6 +3309,7 @@ static int mqtt_connect_with_results(mqtt_client_t* c)
     int len = 0;                              // 存储序列化后的 CONNECT 报文长度
     int rc = MQTT_CONNECT_FAILED_ERROR;       // 返回码，初始化为失败
     platform_timer_t connect_timer;           // 用于等待 CONNACK 的超时定时器
+    unsigned long connect_start;              // 开始建立连接的时间，用于统计端点的连接延迟
     mqtt_connack_data_t connack_data = {0};   // 存储 CONNACK 解析结果
     // 初始化 CONNECT 报文数据结构（来自 Paho MQTT 库）
     MQTTPacket_connectData connect_data = MQTTPacket_connectData_initializer;
@@ -1562,6 +3323,9 @@ static int mqtt_connect_with_results(mqtt_client_t* c)
     if (CLIENT_STATE_CONNECTED == mqtt_get_client_state(c))
         RETURN_ERROR(MQTT_SUCCESS_ERROR);
 
+    // 配置了多个服务器端点时，选择延迟最低的可用端点
+    mqtt_endpoint_prepare(c);
+
 #ifndef MQTT_NETWORK_TYPE_NO_TLS
     // 初始化网络层（支持 TLS）
     // 传入 CA 证书用于验证服务器
@@ -1571,11 +3335,14 @@ static int mqtt_connect_with_results(mqtt_client_t* c)
     rc = network_init(c->mqtt_network, c->mqtt_host, c->mqtt_port, NULL);
 #endif
 
-    // 建立底层网络连接（TCP/TLS）
+    // 建立底层网络连接（TCP/TLS），连接耗时不超过命令超时时间
+    network_set_connect_timeout(c->mqtt_network, c->mqtt_cmd_timeout);
+    connect_start = platform_timer_now();
     rc = network_connect(c->mqtt_network);
     if (MQTT_SUCCESS_ERROR != rc) {
         // 连接失败，释放网络资源
         if (NULL != c->mqtt_network) {
+            mqtt_endpoint_connected(c, rc, 0);
             network_release(c->mqtt_network);
             RETURN_ERROR(rc);  // 直接返回网络层错误码
         }  
@@ -1601,9 +3368,13 @@ static int mqtt_connect_with_results(mqtt_client_t* c)
         connect_data.will.message.cstring   = c->mqtt_will_options->will_message;
     }
     
-    // 设置"最后接收时间"为当前时间 + keepAliveInterval
+    // 设置"最后接收时间"为当前时间
     // 用于后续 PING 操作的判断
-    platform_timer_cutdown(&c->mqtt_last_received, (c->mqtt_keep_alive_interval * 1000));
+    c->mqtt_now = platform_timer_now();
+    c->mqtt_last_received = c->mqtt_now;
+
+    // 丢弃上一个连接残留在接收缓冲区中的数据
+    mqtt_read_buf_reset(c);
 
     // 加锁，保护发送过程（避免多线程并发发送）
     platform_mutex_lock(&c->mqtt_write_lock);
@@ -1631,7 +3402,7 @@ static int mqtt_connect_with_results(mqtt_client_t* c)
     if (mqtt_wait_packet(c, CONNACK, &connect_timer) == CONNACK) {
         // 成功收到 CONNACK，尝试反序列化解析
         if (MQTTDeserialize_connack(&connack_data.session_present, &connack_data.rc,
-                                    c->mqtt_read_buf, c->mqtt_read_buf_size) == 1) {
+                                    MQTT_READ_FRAME(c), c->mqtt_read_frame_len) == 1) {
             // 解析成功，获取返回码（0=连接成功，其他为错误）
             rc = connack_data.rc;
         } else {
@@ -1644,10 +3415,38 @@ static int mqtt_connect_with_results(mqtt_client_t* c)
     }
 
 exit:
+    // 保存会话存在标志，重连时据此决定是否需要重新订阅
+    c->mqtt_session_present = (MQTT_SUCCESS_ERROR == rc) ? connack_data.session_present : 0;
+
     // 根据连接结果进行后续处理
     if (rc == MQTT_SUCCESS_ERROR) {
         // 连接成功
 
+#ifdef MQTT_USING_WRITER_THREAD
+        // 新的连接：写队列中上一次连接遗留的报文作废
+        __atomic_add_fetch(&c->mqtt_writer_epoch, 1, __ATOMIC_SEQ_CST);
+        if ((NULL == c->mqtt_writer_thread) && (MQTT_SUCCESS_ERROR != mqtt_writer_start(c)))
+            MQTT_LOG_W("%s:%d %s()... mqtt writer thread creat failed, send packets directly...", __FILE__, __LINE__, __FUNCTION__);
+#endif
+
+#ifdef MQTT_USING_REACTOR
+        if (mqtt_reactor_is_used(c)) {
+            // 事件循环模式：先置为已连接，避免事件循环把第一个可读事件当作过期事件丢弃
+            mqtt_set_client_state(c, CLIENT_STATE_CONNECTED);
+
+            if (NULL == c->mqtt_reactor_node.loop)
+                rc = mqtt_reactor_attach(c->mqtt_reactor, &c->mqtt_reactor_node, c->mqtt_network->socket);
+            else
+                rc = mqtt_reactor_update(&c->mqtt_reactor_node, c->mqtt_network->socket);   // 重连：重新注册新的 socket
+
+            if (MQTT_SUCCESS_ERROR != rc) {
+                network_release(c->mqtt_network);
+                mqtt_set_client_state(c, CLIENT_STATE_DISCONNECTED);
+                rc = MQTT_CONNECT_FAILED_ERROR;
+                MQTT_LOG_W("%s:%d %s()... mqtt reactor attach failed...", __FILE__, __LINE__, __FUNCTION__);
+            }
+        } else
+#endif
         if (NULL == c->mqtt_thread) {
             // 第一次连接：需要创建并启动 MQTT 主循环线程（用于自动 yield）
 
@@ -1681,12 +3480,16 @@ exit:
     } else {
         // 连接失败
         network_release(c->mqtt_network);                            // 释放网络连接
-        mqtt_set_client_state(c, CLIENT_STATE_INITIALIZED);          // 恢复到初始化状态
+        /* 重连失败时保持断开状态：内部线程或事件循环继续重连，也由它在 mqtt_disconnect() 之后清理会话 */
+        mqtt_set_client_state(c, mqtt_is_driven(c) ? CLIENT_STATE_DISCONNECTED : CLIENT_STATE_INITIALIZED);
     }
     
     // 释放发送锁
     platform_mutex_unlock(&c->mqtt_write_lock);
 
+    // 更新当前端点的连接延迟或失败次数
+    mqtt_endpoint_connected(c, rc, (uint32_t)(platform_timer_now() - connect_start));
+
     // 返回最终结果
     RETURN_ERROR(rc);
 }
@@ -1716,12 +3519,15 @@ static uint32_t mqtt_read_buf_malloc(mqtt_client_t* c, uint32_t size)
     if ((MQTT_MIN_PAYLOAD_SIZE >= c->mqtt_read_buf_size) || (MQTT_MAX_PAYLOAD_SIZE <= c->mqtt_read_buf_size))
         c->mqtt_read_buf_size = MQTT_DEFAULT_BUF_SIZE;
     
-    c->mqtt_read_buf = (uint8_t*) platform_memory_alloc(c->mqtt_read_buf_size);
+    /* 多分配 1 字节，投递消息时用于在负载末尾临时添加字符串结束符 */
+    c->mqtt_read_buf = (uint8_t*) platform_memory_alloc(c->mqtt_read_buf_size + 1);
     
     if (NULL == c->mqtt_read_buf) {
         MQTT_LOG_E("%s:%d %s()... malloc read buf failed...", __FILE__, __LINE__, __FUNCTION__);
         RETURN_ERROR(MQTT_MEM_NOT_ENOUGH_ERROR);
     }
+
+    mqtt_read_buf_reset(c);
     return c->mqtt_read_buf_size;
 }
 
@@ -1770,6 +3576,12 @@ static uint32_t mqtt_write_buf_malloc(mqtt_client_t* c, uint32_t size)
  */
 static int mqtt_init(mqtt_client_t* c)
 {
+    int i;
+    mqtt_list_t *slots;
+#ifdef MQTT_USING_WRITER_THREAD
+    mqtt_ring_cell_t *cells;
+#endif
+
     /* 网络初始化 */
     c->mqtt_network = (network_t*) platform_memory_alloc(sizeof(network_t));
 
@@ -1778,12 +3590,19 @@ static int mqtt_init(mqtt_client_t* c)
         RETURN_ERROR(MQTT_MEM_NOT_ENOUGH_ERROR);
     }
     memset(c->mqtt_network, 0, sizeof(network_t));
+    c->mqtt_network->socket = -1;
 
-    c->mqtt_packet_id = 1;
+    c->mqtt_packet_id = 0;
     c->mqtt_clean_session = 0;          //默认不清除会话
     c->mqtt_will_flag = 0;
     c->mqtt_cmd_timeout = MQTT_DEFAULT_CMD_TIMEOUT;
+    c->mqtt_inflight_max = MQTT_ACK_HANDLER_NUM_MAX;
+    c->mqtt_inflight_timeout = MQTT_INFLIGHT_TIMEOUT;
+    c->mqtt_srtt = 0;
+    c->mqtt_rttvar = 0;
+    c->mqtt_rto = 0;
     c->mqtt_client_state = CLIENT_STATE_INITIALIZED;
+    c->mqtt_session_present = 0;
     
     c->mqtt_ping_outstanding = 0;
     c->mqtt_ack_handler_number = 0;
@@ -1792,7 +3611,19 @@ static int mqtt_init(mqtt_client_t* c)
     c->mqtt_password_len = 0;
     c->mqtt_keep_alive_interval = MQTT_KEEP_ALIVE_INTERVAL;
     c->mqtt_version = MQTT_VERSION;
-    c->mqtt_reconnect_try_duration = MQTT_RECONNECT_DEFAULT_DURATION;
+    c->mqtt_reconnect_seed = 0;
+    c->mqtt_reconnect_policy.base = MQTT_RECONNECT_DEFAULT_DURATION;
+    c->mqtt_reconnect_policy.cap = MQTT_RECONNECT_MAX_DURATION;
+    c->mqtt_reconnect_policy.jitter = MQTT_RECONNECT_JITTER;
+    c->mqtt_reconnect_policy.breaker_threshold = MQTT_RECONNECT_BREAKER_THRESHOLD;
+    c->mqtt_reconnect_policy.breaker_cooldown = MQTT_RECONNECT_BREAKER_COOLDOWN;
+    memset(&c->mqtt_reconnect_stats, 0, sizeof(c->mqtt_reconnect_stats));
+    platform_timer_init(&c->mqtt_reconnect_timer);
+    c->mqtt_endpoints = NULL;
+    c->mqtt_endpoint_number = 0;
+    c->mqtt_endpoint_current = -1;
+    c->mqtt_endpoint_live = 0;
+    c->mqtt_ping_sent = 0;
 
     c->mqtt_will_options = NULL;
     c->mqtt_reconnect_data = NULL;
@@ -1803,13 +3634,68 @@ static int mqtt_init(mqtt_client_t* c)
     mqtt_write_buf_malloc(c, MQTT_DEFAULT_BUF_SIZE);
 
     mqtt_list_init(&c->mqtt_msg_handler_list);
+    mqtt_topic_tree_init(&c->mqtt_msg_handler_tree);
     mqtt_list_init(&c->mqtt_ack_handler_list);
+
+    c->mqtt_ack_hash = (mqtt_list_t *)platform_memory_alloc(sizeof(mqtt_list_t) * MQTT_ACK_HASH_SIZE);
+    MQTT_ROBUSTNESS_CHECK(c->mqtt_ack_hash, MQTT_MEM_NOT_ENOUGH_ERROR);
+    for (i = 0; i < MQTT_ACK_HASH_SIZE; i++)
+        mqtt_list_init(&c->mqtt_ack_hash[i]);
+
+    c->mqtt_packet_id_map = (uint32_t *)platform_memory_alloc(sizeof(uint32_t) * MQTT_PACKET_ID_MAP_WORDS);
+    MQTT_ROBUSTNESS_CHECK(c->mqtt_packet_id_map, MQTT_MEM_NOT_ENOUGH_ERROR);
+    memset(c->mqtt_packet_id_map, 0, sizeof(uint32_t) * MQTT_PACKET_ID_MAP_WORDS);
+
+    slots = (mqtt_list_t *)platform_memory_alloc(sizeof(mqtt_list_t) * MQTT_ACK_WHEEL_SLOTS);
+    MQTT_ROBUSTNESS_CHECK(slots, MQTT_MEM_NOT_ENOUGH_ERROR);
+    mqtt_wheel_init(&c->mqtt_ack_wheel, slots, MQTT_ACK_WHEEL_SLOTS, MQTT_ACK_WHEEL_TICK, platform_timer_now());
     
     platform_mutex_init(&c->mqtt_write_lock);
     platform_mutex_init(&c->mqtt_global_lock);
+    platform_sem_init(&c->mqtt_inflight_sem);
+    c->mqtt_inflight_waiters = 0;
+
+#ifdef MQTT_USING_MEMORY_POOL
+    mqtt_pool_init(&c->mqtt_pool);
+#endif
+
+    c->mqtt_last_sent = 0;
+    c->mqtt_last_received = 0;
+    c->mqtt_now = platform_timer_now();
+
+#ifdef MQTT_USING_PUBLISH_ASYNC
+    mqtt_list_init(&c->mqtt_publish_queue);
+    platform_mutex_init(&c->mqtt_publish_queue_lock);
+    c->mqtt_publish_queue_number = 0;
+#endif
+
+#ifdef MQTT_USING_WRITER_THREAD
+    cells = (mqtt_ring_cell_t *)platform_memory_alloc(sizeof(mqtt_ring_cell_t) * MQTT_WRITER_RING_SIZE);
+    MQTT_ROBUSTNESS_CHECK(cells, MQTT_MEM_NOT_ENOUGH_ERROR);
+    mqtt_ring_init(&c->mqtt_writer_ring, cells, MQTT_WRITER_RING_SIZE);
+    if (MQTT_SUCCESS_ERROR != platform_event_init(&c->mqtt_writer_event)) {
+        platform_memory_free(cells);
+        RETURN_ERROR(MQTT_FAILED_ERROR);
+    }
+    if (MQTT_SUCCESS_ERROR != platform_event_init(&c->mqtt_writer_space_event)) {
+        platform_event_destroy(&c->mqtt_writer_event);
+        platform_memory_free(cells);
+        RETURN_ERROR(MQTT_FAILED_ERROR);
+    }
+    platform_mutex_init(&c->mqtt_writer_lock);
+    c->mqtt_writer_thread = NULL;
+    c->mqtt_writer_epoch = 0;
+    c->mqtt_writer_pending = 0;
+    c->mqtt_writer_blocked = 0;
+    c->mqtt_writer_running = 0;
+    c->mqtt_writer_sleeping = 0;
+    c->mqtt_writer_alive = 0;
+#endif
 
-    platform_timer_init(&c->mqtt_last_sent);
-    platform_timer_init(&c->mqtt_last_received);
+#ifdef MQTT_USING_REACTOR
+    c->mqtt_reactor = NULL;
+    mqtt_reactor_node_init(&c->mqtt_reactor_node, mqtt_reactor_handler, c);
+#endif
 
     RETURN_ERROR(MQTT_SUCCESS_ERROR);
 }
@@ -1828,9 +3714,30 @@ MQTT_CLIENT_SET_DEFINE(will_flag, uint32_t, 0)
 MQTT_CLIENT_SET_DEFINE(clean_session, uint32_t, 0)
 MQTT_CLIENT_SET_DEFINE(version, uint32_t, 0)
 MQTT_CLIENT_SET_DEFINE(cmd_timeout, uint32_t, 0)
-MQTT_CLIENT_SET_DEFINE(reconnect_try_duration, uint32_t, 0)
+MQTT_CLIENT_SET_DEFINE(inflight_max, uint32_t, 0)
+MQTT_CLIENT_SET_DEFINE(inflight_timeout, uint32_t, 0)
 MQTT_CLIENT_SET_DEFINE(reconnect_handler, reconnect_handler_t, NULL)
 MQTT_CLIENT_SET_DEFINE(interceptor_handler, interceptor_handler_t, NULL)
+#ifdef MQTT_USING_REACTOR
+MQTT_CLIENT_SET_DEFINE(reactor, mqtt_reactor_t*, NULL)
+#endif
+#ifdef MQTT_USING_STREAM_RECEIVE
+MQTT_CLIENT_SET_DEFINE(stream_handler, stream_handler_t, NULL)
+#endif
+
+/**
+ * @brief 设置重连退避的初始等待时间（毫秒），即重连策略中的 base
+ *
+ * @see mqtt_set_reconnect_policy()
+ */
+uint32_t mqtt_set_reconnect_try_duration(mqtt_client_t *c, uint32_t t)
+{
+    MQTT_ROBUSTNESS_CHECK((c), 0);
+    platform_mutex_lock(&c->mqtt_global_lock);
+    c->mqtt_reconnect_policy.base = t;
+    platform_mutex_unlock(&c->mqtt_global_lock);
+    return t;
+}
 
 /**
  * @brief 设置读缓冲区大小
@@ -1867,28 +3774,31 @@ void mqtt_sleep_ms(int ms)
 }
 
 /**
- * @brief MQTT 保活机制处理
+ * @brief 按给定的当前时间执行保活处理
  * 
- * 检查是否需要发送 PINGREQ 报文以维持连接，或处理 PING 超时。
- * 当超过保活间隔时间未发送或接收数据时，发送 PINGREQ。
- * 如果 PING 请求未收到响应，则断开连接。
+ * 客户端线程和事件循环使用刚刷新的 c->mqtt_now 调用，避免重复读取时钟。
  * 
- * @param[in] c  指向 MQTT 客户端实例的指针
- * @return 
- *   - MQTT_SUCCESS_ERROR: 保活处理成功
- *   - MQTT_NOT_CONNECT_ERROR: 连接已断开
- *   - 其他错误码: 保活处理失败
+ * @param[in] c    指向 MQTT 客户端实例的指针
+ * @param[in] now  当前时间（毫秒）
+ * @return 见 mqtt_keep_alive()
  */
-int mqtt_keep_alive(mqtt_client_t* c)
+static int mqtt_keep_alive_check(mqtt_client_t* c, unsigned long now)
 {
     int rc = MQTT_SUCCESS_ERROR;
+    unsigned long interval;
     
     rc = mqtt_is_connected(c);
     if (MQTT_SUCCESS_ERROR != rc)
         RETURN_ERROR(rc);
 
-    if (platform_timer_is_expired(&c->mqtt_last_sent) || platform_timer_is_expired(&c->mqtt_last_received)) {
+    interval = c->mqtt_keep_alive_interval * 1000;
+    if (MQTT_TIME_IS_ELAPSED(now, c->mqtt_last_sent, interval) || 
+        MQTT_TIME_IS_ELAPSED(now, c->mqtt_last_received, interval)) {
         if (c->mqtt_ping_outstanding) {
+            /* PINGRESP 的等待时间从发出 PINGREQ 开始计算 */
+            if (!MQTT_TIME_IS_ELAPSED(now, c->mqtt_ping_sent, interval))
+                RETURN_ERROR(rc);
+
             MQTT_LOG_W("%s:%d %s()... ping outstanding", __FILE__, __LINE__, __FUNCTION__);
             /*必须释放 socket 文件描述符 zhaoshimin 20200629*/
             network_release(c->mqtt_network);
@@ -1897,16 +3807,40 @@ int mqtt_keep_alive(mqtt_client_t* c)
             rc = MQTT_NOT_CONNECT_ERROR; /* 在保活间隔内未收到 PINGRESP */
         } else {
             platform_timer_t timer;
-            int len = MQTTSerialize_pingreq(c->mqtt_write_buf, c->mqtt_write_buf_size);
+            int len;
+
+            /* 写缓冲区与发布、异步队列和写线程共用，序列化和发送都必须持有写锁 */
+            platform_mutex_lock(&c->mqtt_write_lock);
+            len = MQTTSerialize_pingreq(c->mqtt_write_buf, c->mqtt_write_buf_size);
             if (len > 0)
                 rc = mqtt_send_packet(c, len, &timer); // 100ask, 发送 ping 报文
+            platform_mutex_unlock(&c->mqtt_write_lock);
             c->mqtt_ping_outstanding++;
+            c->mqtt_ping_sent = now;
         }
     }
 
     RETURN_ERROR(rc);
 }
 
+/**
+ * @brief MQTT 保活机制处理
+ * 
+ * 检查是否需要发送 PINGREQ 报文以维持连接，或处理 PING 超时。
+ * 当超过保活间隔时间未发送或接收数据时，发送 PINGREQ。
+ * 如果 PING 请求未收到响应，则断开连接。
+ * 
+ * @param[in] c  指向 MQTT 客户端实例的指针
+ * @return 
+ *   - MQTT_SUCCESS_ERROR: 保活处理成功
+ *   - MQTT_NOT_CONNECT_ERROR: 连接已断开
+ *   - 其他错误码: 保活处理失败
+ */
+int mqtt_keep_alive(mqtt_client_t* c)
+{
+    return mqtt_keep_alive_check(c, platform_timer_now());
+}
+
 /**
  * @brief 创建并初始化 MQTT 客户端实例
  * 
@@ -1937,6 +3871,14 @@ mqtt_client_t *mqtt_lease(void)
     return c;
 }
 
+/**
+ * @brief 客户端是否从未连接成功过，此时没有内部线程或事件循环在使用客户端
+ */
+static int mqtt_never_connected(mqtt_client_t* c)
+{
+    return (CLIENT_STATE_INITIALIZED == mqtt_get_client_state(c)) && !mqtt_is_driven(c);
+}
+
 /**
  * @brief 释放 MQTT 客户端资源
  * 
@@ -1956,6 +3898,9 @@ mqtt_client_t *mqtt_lease(void)
 int mqtt_release(mqtt_client_t* c)
 {
     platform_timer_t timer;
+#ifdef MQTT_USING_WRITER_THREAD
+    mqtt_writer_frame_t *frame;
+#endif
 
     if (NULL == c)
         RETURN_ERROR(MQTT_NULL_VALUE_ERROR);
@@ -1963,8 +3908,8 @@ int mqtt_release(mqtt_client_t* c)
     platform_timer_init(&timer);
     platform_timer_cutdown(&timer, c->mqtt_cmd_timeout);
     
-    /* 等待会话清理完成 */
-    while ((CLIENT_STATE_INVALID != mqtt_get_client_state(c))) {
+    /* 等待会话清理完成，从未连接成功过的客户端没有后台线程，不需要等待 */
+    while ((CLIENT_STATE_INVALID != mqtt_get_client_state(c)) && !mqtt_never_connected(c)) {
         // platform_timer_usleep(1000);            // 1ms 避免编译器优化
         if (platform_timer_is_expired(&timer)) {
             MQTT_LOG_E("%s:%d %s()... mqtt release failed...", __FILE__, __LINE__, __FUNCTION__);
@@ -1987,8 +3932,45 @@ int mqtt_release(mqtt_client_t* c)
         c->mqtt_write_buf = NULL;
     }
 
+    if (NULL != c->mqtt_ack_hash) {
+        platform_memory_free(c->mqtt_ack_hash);
+        c->mqtt_ack_hash = NULL;
+    }
+
+    if (NULL != c->mqtt_packet_id_map) {
+        platform_memory_free(c->mqtt_packet_id_map);
+        c->mqtt_packet_id_map = NULL;
+    }
+
+    if (NULL != c->mqtt_endpoints) {
+        platform_memory_free(c->mqtt_endpoints);
+        c->mqtt_endpoints = NULL;
+        c->mqtt_endpoint_number = 0;
+    }
+
+    if (NULL != c->mqtt_ack_wheel.slots) {
+        platform_memory_free(c->mqtt_ack_wheel.slots);
+        c->mqtt_ack_wheel.slots = NULL;
+    }
+
     platform_mutex_destroy(&c->mqtt_write_lock);
     platform_mutex_destroy(&c->mqtt_global_lock);
+    platform_sem_destroy(&c->mqtt_inflight_sem);
+#ifdef MQTT_USING_PUBLISH_ASYNC
+    platform_mutex_destroy(&c->mqtt_publish_queue_lock);
+#endif
+#ifdef MQTT_USING_WRITER_THREAD
+    /* 写线程退出后仍可能有发布线程放入的报文 */
+    while (NULL != (frame = (mqtt_writer_frame_t *)mqtt_ring_pop(&c->mqtt_writer_ring)))
+        MQTT_OBJECT_FREE(c, frame);
+    platform_memory_free(c->mqtt_writer_ring.cells);
+    platform_event_destroy(&c->mqtt_writer_event);
+    platform_event_destroy(&c->mqtt_writer_space_event);
+    platform_mutex_destroy(&c->mqtt_writer_lock);
+#endif
+#ifdef MQTT_USING_MEMORY_POOL
+    mqtt_pool_destroy(&c->mqtt_pool);
+#endif
 
     memset(c, 0, sizeof(mqtt_client_t));
 
@@ -2012,8 +3994,16 @@ int mqtt_release(mqtt_client_t* c)
  */
 int mqtt_connect(mqtt_client_t* c)
 {
-    /* 以阻塞模式连接服务器并等待连接结果 */
-    return mqtt_connect_with_results(c);
+    int rc;
+    uint32_t tries = 0;
+
+    /* 以阻塞模式连接服务器并等待连接结果，配置了多个端点时依次尝试每个可用的端点 */
+    do {
+        rc = mqtt_connect_with_results(c);
+    } while ((MQTT_SUCCESS_ERROR != rc) && (NULL != c) && 
+             (++tries < c->mqtt_endpoint_number) && mqtt_endpoint_available(c));
+
+    return rc;
 }
 
 /**
@@ -2040,6 +4030,12 @@ int mqtt_disconnect(mqtt_client_t* c)
     platform_timer_init(&timer);
     platform_timer_cutdown(&timer, c->mqtt_cmd_timeout);
 
+#ifdef MQTT_USING_WRITER_THREAD
+    /* 先让写线程发完已入队的报文并退出，DISCONNECT 直接发送，保证它是最后一个报文 */
+    mqtt_writer_drain(c, &timer);
+    mqtt_writer_stop(c);
+#endif
+
     platform_mutex_lock(&c->mqtt_write_lock);
 
     /* 序列化断开连接报文并发送 */
@@ -2049,13 +4045,125 @@ int mqtt_disconnect(mqtt_client_t* c)
 
     platform_mutex_unlock(&c->mqtt_write_lock);
 
+    c->mqtt_endpoint_live = 0;      /* 主动断开，不算作当前端点的失败 */
     mqtt_set_client_state(c, CLIENT_STATE_CLEAN_SESSION);
+
+#ifdef MQTT_USING_REACTOR
+    /* 让事件循环立即清理会话，而不是等到下一次 tick */
+    mqtt_reactor_wakeup(&c->mqtt_reactor_node);
+#endif
     
     RETURN_ERROR(rc);
 }
 
 /**
- * @brief 订阅一个或多个 MQTT 主题
+ * @brief 把 subs 中尽可能多的主题过滤器打包进一个 SUBSCRIBE 报文并发送
+ *
+ * 一个报文最多 MQTT_SUBSCRIBE_BATCH_MAX 个主题，并且不超过写缓冲区的大小。
+ * install 为 1 时为每个主题创建消息处理器，与 SUBACK 的 ACK 处理器一起保存，收到 SUBACK 后按授权结果安装；
+ * install 为 0 时用于重连后重新订阅，消息处理器已经安装，只需要让服务器恢复订阅。
+ *
+ * @param[in] c        指向 MQTT 客户端实例的指针
+ * @param[in] subs     订阅请求数组
+ * @param[in] count    订阅请求个数
+ * @param[in] install  是否创建并在确认后安装消息处理器
+ * @return
+ *   - > 0: 本次报文中打包的主题个数
+ *   - MQTT_BUFFER_TOO_SHORT_ERROR: 写缓冲区放不下第一个主题
+ *   - MQTT_MEM_NOT_ENOUGH_ERROR: 内存不足
+ *   - 其他错误码: 序列化或发送失败
+ */
+static int mqtt_subscribe_frame(mqtt_client_t* c, const mqtt_subscription_t* subs, int count, int install)
+{
+    int i, n, len, add;
+    int rem_len = 2;                      // 剩余长度：报文 ID
+    int rc = MQTT_SUCCESS_ERROR;
+    uint16_t packet_id;
+    platform_timer_t timer;
+    MQTTString *topics;
+    int *qos_levels;
+    message_handlers_t **handlers;
+
+    if (count > MQTT_SUBSCRIBE_BATCH_MAX)
+        count = MQTT_SUBSCRIBE_BATCH_MAX;
+
+    /* 主题、QoS 和消息处理器的临时数组一次分配 */
+    topics = (MQTTString *)platform_memory_alloc(count * (sizeof(MQTTString) + sizeof(int) + sizeof(message_handlers_t *)));
+    if (NULL == topics)
+        RETURN_ERROR(MQTT_MEM_NOT_ENOUGH_ERROR);
+    handlers = (message_handlers_t **)(topics + count);
+    qos_levels = (int *)(handlers + count);
+
+    platform_mutex_lock(&c->mqtt_write_lock);
+
+    /* 每个主题占 2 字节长度 + 主题 + 1 字节 QoS */
+    for (n = 0; n < count; n++) {
+        add = 2 + (int)strlen(subs[n].topic_filter) + 1;
+        if (MQTTPacket_len(rem_len + add) > (int)c->mqtt_write_buf_size)
+            break;
+        rem_len += add;
+
+        topics[n].cstring = (char *)subs[n].topic_filter;
+        topics[n].lenstring.len = 0;
+        topics[n].lenstring.data = NULL;
+        qos_levels[n] = subs[n].qos;
+    }
+
+    if (0 == n) {
+        rc = MQTT_BUFFER_TOO_SHORT_ERROR;
+        goto exit;
+    }
+
+    if (0 == (packet_id = mqtt_get_next_packet_id(c))) {
+        rc = MQTT_ACK_HANDLER_NUM_TOO_MUCH_ERROR;
+        goto exit;
+    }
+
+    len = MQTTSerialize_subscribe(c->mqtt_write_buf, c->mqtt_write_buf_size, 0, packet_id, n, topics, qos_levels);
+    if (len <= 0) {
+        rc = MQTT_SUBSCRIBE_ERROR;
+        goto exit;
+    }
+
+    /* 先分配消息处理器和 ACK 处理器，都成功后才发送，避免服务器已经订阅而本端没有记录 */
+    if (install) {
+        for (i = 0; i < n; i++) {
+            handlers[i] = mqtt_msg_handler_create(c, subs[i].topic_filter, subs[i].qos, 
+                                                  (NULL != subs[i].handler) ? subs[i].handler : default_msg_handler);
+            if (NULL == handlers[i]) {
+                while (i-- > 0)
+                    mqtt_msg_handler_destory(c, handlers[i]);
+                rc = MQTT_MEM_NOT_ENOUGH_ERROR;
+                goto exit;
+            }
+        }
+    }
+
+    /* SUBSCRIBE 不重发，ACK 处理器中只保存消息处理器指针数组，收到 SUBACK 时按顺序与授权结果对应 */
+    rc = mqtt_ack_list_record(c, SUBACK, packet_id, 0, (uint8_t *)handlers, install ? n * sizeof(message_handlers_t *) : 0, NULL);
+    if (MQTT_SUCCESS_ERROR == rc) {
+        rc = mqtt_send_packet(c, len, &timer);
+        if (MQTT_SUCCESS_ERROR != rc)
+            mqtt_ack_handler_destroy(c, mqtt_ack_list_find(c, SUBACK, packet_id));
+    }
+
+    if ((MQTT_SUCCESS_ERROR != rc) && install) {
+        for (i = 0; i < n; i++)
+            mqtt_msg_handler_destory(c, handlers[i]);
+    }
+
+exit:
+    platform_mutex_unlock(&c->mqtt_write_lock);
+    platform_memory_free(topics);
+
+    if (MQTT_SUCCESS_ERROR != rc)
+        RETURN_ERROR(rc);
+
+    return n;
+}
+
+/**
+ * @brief 订阅 MQTT 主题
  *
  * 该函数向 MQTT Broker 发送 SUBSCRIBE 报文，请求订阅指定的主题过滤器（topic filter）。
  * 当有匹配主题的消息发布时，Broker 会向客户端推送消息，并由注册的回调函数处理。
@@ -2077,69 +4185,57 @@ int mqtt_disconnect(mqtt_client_t* c)
  *   - handler 回调会被异步调用（通常在接收线程或事件循环中），应保证线程安全。
  *   - 若指定 NULL handler，则使用 default_msg_handler 处理该主题的消息。
  *
- * @see mqtt_ack_list_record(), default_msg_handler, mqtt_msg_handler_create()
+ * @see mqtt_subscribe_many(), default_msg_handler, mqtt_msg_handler_create()
  */
 int mqtt_subscribe(mqtt_client_t* c, const char* topic_filter, mqtt_qos_t qos, message_handler_t handler)
 {
-    int rc = MQTT_SUBSCRIBE_ERROR;        // 返回码，初始化为订阅错误
-    int len = 0;                          // 序列化后的报文长度
-    int qos_level = qos;                  // 避免枚举对齐问题（某些编译器 enum != int）
-    uint16_t packet_id;                   // 当前订阅请求的报文 ID
-    platform_timer_t timer;               // 用于超时控制的定时器
-    MQTTString topic = MQTTString_initializer; // MQTT 字符串结构体
-    topic.cstring = (char *)topic_filter;      // 设置主题过滤器
-    message_handlers_t *msg_handler = NULL;    // 本地消息处理器指针
+    mqtt_subscription_t sub;
 
-    // 检查客户端是否已连接
-    if (CLIENT_STATE_CONNECTED != mqtt_get_client_state(c))
-        RETURN_ERROR(MQTT_NOT_CONNECT_ERROR); // 未连接则直接返回错误
-
-    // 加锁，防止多线程并发写入写缓冲区
-    platform_mutex_lock(&c->mqtt_write_lock);
+    sub.topic_filter = topic_filter;
+    sub.qos = qos;
+    sub.handler = handler;
 
-    // 获取下一个可用的报文 ID（用于匹配后续的 SUBACK）
-    packet_id = mqtt_get_next_packet_id(c);
-
-    /* 序列化 SUBSCRIBE 报文到写缓冲区 */
-    len = MQTTSerialize_subscribe(
-              c->mqtt_write_buf,          // 输出缓冲区
-              c->mqtt_write_buf_size,     // 缓冲区大小
-              0,                          // dup 标志（SUBSCRIBE 报文初始为 0）
-              packet_id,                  // 报文 ID
-              1,                          // 订阅主题数量（目前只支持单个）
-              &topic,                     // 主题过滤器
-              (int *)&qos_level           // 请求的 QoS 级别
-          );
-
-    // 序列化失败（返回值 <= 0），跳转至清理
-    if (len <= 0)
-        goto exit;
+    return mqtt_subscribe_many(c, &sub, 1);
+}
 
-    // 将序列化后的 SUBSCRIBE 报文通过网络发送
-    if ((rc = mqtt_send_packet(c, len, &timer)) != MQTT_SUCCESS_ERROR)
-        goto exit; // 发送失败，跳转退出
+/**
+ * @brief 一次订阅多个 MQTT 主题
+ *
+ * 主题过滤器按顺序打包进尽量少的 SUBSCRIBE 报文（每个报文不超过写缓冲区大小和 MQTT_SUBSCRIBE_BATCH_MAX 个主题），
+ * 每个报文只占用一个 ACK 处理器。服务器在 SUBACK 中逐个返回授权结果，被拒绝的主题不会安装消息处理器。
+ *
+ * @param[in]  c      指向已连接的 MQTT 客户端实例
+ * @param[in]  subs   订阅请求数组，主题过滤器在订阅期间必须保持有效
+ * @param[in]  count  订阅请求个数
+ *
+ * @return
+ *   - MQTT_SUCCESS_ERROR (0): 所有订阅请求已发送（不代表 Broker 已确认）
+ *   - MQTT_NOT_CONNECT_ERROR: 客户端未连接
+ *   - MQTT_BUFFER_TOO_SHORT_ERROR: 某个主题过滤器放不进写缓冲区
+ *   - 其他错误码: 发送失败，之前的报文已经发出
+ *
+ * @see mqtt_subscribe()
+ */
+int mqtt_subscribe_many(mqtt_client_t* c, const mqtt_subscription_t* subs, int count)
+{
+    int rc = MQTT_SUCCESS_ERROR;
 
-    // 若未指定回调函数，则使用默认消息处理器
-    if (NULL == handler)
-        handler = default_msg_handler;
+    if ((NULL == c) || (NULL == subs) || (count <= 0))
+        RETURN_ERROR(MQTT_NULL_VALUE_ERROR);
 
-    // 创建一个消息处理器节点，用于保存主题、QoS 和回调函数
-    msg_handler = mqtt_msg_handler_create(topic_filter, qos, handler);
-    if (NULL == msg_handler) {
-        rc = MQTT_MEM_NOT_ENOUGH_ERROR; // 分配失败，内存不足
-        goto exit;
-    }
+    if (CLIENT_STATE_CONNECTED != mqtt_get_client_state(c))
+        RETURN_ERROR(MQTT_NOT_CONNECT_ERROR);
 
-    // 将订阅请求记录到 ACK 列表，等待 SUBACK 确认
-    // 记录成功后，若超时未收到 SUBACK，将触发重传机制
-    rc = mqtt_ack_list_record(c, SUBACK, packet_id, len, msg_handler);
+    while (count > 0) {
+        rc = mqtt_subscribe_frame(c, subs, count, 1);
+        if (rc < 0)
+            RETURN_ERROR(rc);
 
-exit:
-    // 释放写锁
-    platform_mutex_unlock(&c->mqtt_write_lock);
+        subs += rc;
+        count -= rc;
+    }
 
-    // 返回最终结果（可能为成功、内存不足、发送失败等）
-    RETURN_ERROR(rc);
+    RETURN_ERROR(MQTT_SUCCESS_ERROR);
 }
 
 
@@ -2174,7 +4270,10 @@ int mqtt_unsubscribe(mqtt_client_t* c, const char* topic_filter)
     
     platform_mutex_lock(&c->mqtt_write_lock);
 
-    packet_id = mqtt_get_next_packet_id(c);
+    if (0 == (packet_id = mqtt_get_next_packet_id(c))) {
+        rc = MQTT_ACK_HANDLER_NUM_TOO_MUCH_ERROR;
+        goto exit;
+    }
     
     /* 序列化取消订阅报文并发送 */
     if ((len = MQTTSerialize_unsubscribe(c->mqtt_write_buf, c->mqtt_write_buf_size, 0, packet_id, 1, &topic)) <= 0)
@@ -2183,26 +4282,78 @@ int mqtt_unsubscribe(mqtt_client_t* c, const char* topic_filter)
         goto exit; 
 
     /* 获取已订阅的消息处理器 */
-    msg_handler = mqtt_get_msg_handler(c, &topic);
+    msg_handler = (message_handlers_t *)mqtt_topic_tree_find(&c->mqtt_msg_handler_tree, topic_filter);
     if (NULL == msg_handler) {
         rc = MQTT_MEM_NOT_ENOUGH_ERROR;
         goto exit;
     }
 
-    rc = mqtt_ack_list_record(c, UNSUBACK, packet_id, len, msg_handler);
+    rc = mqtt_ack_list_record(c, UNSUBACK, packet_id, len, NULL, 0, msg_handler);
 
 exit:
 
     platform_mutex_unlock(&c->mqtt_write_lock);
 
-    RETURN_ERROR(rc);
+    RETURN_ERROR(rc);
+}
+
+/**
+ * @brief mqtt_publish() 与 mqtt_publish_by_template() 共用的发布流程
+ * 
+ * @param[in] c             指向 MQTT 客户端实例的指针
+ * @param[in] topic_filter  主题（tpl 不为 NULL 时不使用）
+ * @param[in] tpl           报头模板，可为 NULL
+ * @param[in] msg           待发布的消息
+ * @return 见 mqtt_publish()
+ */
+static int mqtt_publish_message(mqtt_client_t* c, const char* topic_filter, const mqtt_publish_template_t* tpl, mqtt_message_t* msg)
+{
+    int rc = MQTT_FAILED_ERROR;     // 返回码，初始化为失败
+
+    // 检查客户端是否处于已连接状态
+    if (CLIENT_STATE_CONNECTED != mqtt_get_client_state(c)) {
+        msg->payloadlen = 0;        // 清空 payload 长度（防御性操作）
+        rc = MQTT_NOT_CONNECT_ERROR; // 设置错误码
+        RETURN_ERROR(rc);           // 使用宏返回错误（可能包含日志输出）
+        // goto exit; /* 100ask */ // 原注释，已被 RETURN_ERROR 替代
+    }
+
+    // 如果 payload 非空但长度为 0，则尝试通过 strlen 自动计算长度
+    // （适用于以 '\0' 结尾的字符串数据）
+    if ((NULL != msg->payload) && (0 == msg->payloadlen))
+        msg->payloadlen = strlen((char*)msg->payload);
+
+    // 负载不经过写缓冲区，只需检查是否超出协议允许的最大长度
+    if (msg->payloadlen > MQTT_MAX_PAYLOAD_SIZE) {
+        MQTT_LOG_E("publish payload len is greater than the mqtt protocol allows..."); // 日志警告
+        RETURN_ERROR(MQTT_BUFFER_TOO_SHORT_ERROR); // 缓冲区不足错误
+    }
+
+    rc = mqtt_publish_packet(c, topic_filter, tpl, msg, NULL, NULL, c->mqtt_inflight_timeout);
+
+    msg->payloadlen = 0;        // 清空 payload 长度，防止误用
+
+    // 特殊错误处理：若因内存不足导致发布失败
+    if (MQTT_MEM_NOT_ENOUGH_ERROR == rc) {
+        MQTT_LOG_W("%s:%d %s()... there is not enough memory space to record...", 
+                   __FILE__, __LINE__, __FUNCTION__);
+
+        /* 释放底层网络文件描述符（避免资源泄漏） */
+        network_release(c->mqtt_network);
+        
+        /* 标记客户端为断开状态，建议上层重新连接 */
+        mqtt_set_client_state(c, CLIENT_STATE_DISCONNECTED);
+    }
+
+    RETURN_ERROR(rc);     // 使用宏返回最终结果（可能包含日志）
 }
 
 /**
  * @brief 发布一条 MQTT 消息到指定主题
  *
  * 该函数将消息发布到指定的 MQTT 主题。根据 QoS 级别，可能需要等待确认（PUBACK 或 PUBREC），
- * 并在未收到确认时进行重传。函数内部会序列化 PUBLISH 报文并通过网络发送。
+ * 并在未收到确认时进行重传。写缓冲区中只序列化 PUBLISH 报头（固定报头、主题和报文 ID），
+ * 负载直接从 msg->payload 与报头一起分散发送，不拷贝到写缓冲区，因此负载大小不受写缓冲区限制。
  *
  * @param[in,out] c             指向 MQTT 客户端实例的指针
  * @param[in]     topic_filter  要发布消息的主题（字符串形式）
@@ -2211,115 +4362,295 @@ exit:
  * @return
  *   - MQTT_SUCCESS_ERROR (0): 成功发送（不保证对方已接收，取决于 QoS）
  *   - MQTT_NOT_CONNECT_ERROR: 客户端未处于连接状态
- *   - MQTT_BUFFER_TOO_SHORT_ERROR: 消息负载长度超过客户端写缓冲区大小
- *   - MQTT_ACK_HANDLER_NUM_TOO_MUCH_ERROR: 待确认的消息数量已达上限（仅 QoS1/QoS2）
+ *   - MQTT_BUFFER_TOO_SHORT_ERROR: 报头（主题）长度超过客户端写缓冲区大小，或负载超过协议上限
+ *   - MQTT_ACK_HANDLER_NUM_TOO_MUCH_ERROR: 发送窗口已满（仅 QoS1/QoS2），连接保持不变，稍后重试即可
  *   - MQTT_MEM_NOT_ENOUGH_ERROR: 内存不足，无法记录重发消息
  *   - 其他负值: 发送过程中的底层网络或序列化错误
  *
  * @note
  *   - 若 QoS > 0，消息会被记录以便重传，直到收到对应确认。
- *   - 若发布失败且因资源耗尽（如内存或 ack handler 满），客户端状态将被置为断开，
- *     建议上层检测到此类错误后尝试重连。
+ *   - 待确认的消息数量达到 mqtt_set_inflight_max() 设置的窗口大小时，最多等待
+ *     mqtt_set_inflight_timeout() 设置的时间让 ACK 腾出位置，超时返回
+ *     MQTT_ACK_HANDLER_NUM_TOO_MUCH_ERROR。
+ *   - 若发布失败且因内存耗尽，客户端状态将被置为断开，建议上层检测到此类错误后尝试重连。
  *   - 函数执行完成后会清空 msg->payloadlen 字段。
  */
 int mqtt_publish(mqtt_client_t* c, const char* topic_filter, mqtt_message_t* msg)
 {
-    int len = 0;                    // 序列化后的报文长度
-    int rc = MQTT_FAILED_ERROR;     // 返回码，初始化为失败
-    platform_timer_t timer;         // 用于超时控制的定时器
-    MQTTString topic = MQTTString_initializer;  // MQTT 字符串结构体，用于序列化
-    topic.cstring = (char *)topic_filter;       // 设置主题字符串
+    return mqtt_publish_message(c, topic_filter, NULL, msg);
+}
 
-    // 检查客户端是否处于已连接状态
-    if (CLIENT_STATE_CONNECTED != mqtt_get_client_state(c)) {
-        msg->payloadlen = 0;        // 清空 payload 长度（防御性操作）
-        rc = MQTT_NOT_CONNECT_ERROR; // 设置错误码
-        RETURN_ERROR(rc);           // 使用宏返回错误（可能包含日志输出）
-        // goto exit; /* 100ask */ // 原注释，已被 RETURN_ERROR 替代
-    }
+/**
+ * @brief 创建 PUBLISH 报头模板
+ * 
+ * 对同一主题反复发布时，预先编码主题并确定固定报头，之后通过 mqtt_publish_by_template() 发布。
+ * 
+ * @param[in] topic     主题，模板保存编码后的副本，调用返回后即可释放
+ * @param[in] qos       QoS 级别
+ * @param[in] retained  retain 标志
+ * @return 创建的模板，参数错误或内存不足时返回 NULL
+ */
+mqtt_publish_template_t *mqtt_publish_template_create(const char* topic, mqtt_qos_t qos, uint8_t retained)
+{
+    size_t len;
+    unsigned char *ptr;
+    MQTTHeader header = {0};
+    mqtt_publish_template_t *tpl;
 
-    // 如果 payload 非空但长度为 0，则尝试通过 strlen 自动计算长度
-    // （适用于以 '\0' 结尾的字符串数据）
-    if ((NULL != msg->payload) && (0 == msg->payloadlen))
-        msg->payloadlen = strlen((char*)msg->payload);
+    if ((NULL == topic) || (qos > QOS2))
+        return NULL;
 
-    // 检查消息负载是否超出客户端写缓冲区容量
-    if (msg->payloadlen > c->mqtt_write_buf_size) {
-        MQTT_LOG_E("publish payload len is greater than client write buffer..."); // 日志警告
-        RETURN_ERROR(MQTT_BUFFER_TOO_SHORT_ERROR); // 缓冲区不足错误
+    len = strlen(topic);
+    if (len > 0xFFFF)
+        return NULL;
+
+    tpl = (mqtt_publish_template_t *)platform_memory_alloc(sizeof(mqtt_publish_template_t) + 2 + len);
+    if (NULL == tpl)
+        return NULL;
+
+    header.bits.type = PUBLISH;
+    header.bits.qos = qos;
+    header.bits.retain = retained;
+
+    tpl->flags = header.byte;
+    tpl->retained = retained;
+    tpl->qos = qos;
+    tpl->topic_len = (uint32_t)(2 + len);
+    tpl->topic = (uint8_t *)tpl + sizeof(mqtt_publish_template_t);
+
+    ptr = tpl->topic;
+    writeInt(&ptr, (int)len);
+    memcpy(ptr, topic, len);
+
+    return tpl;
+}
+
+/**
+ * @brief 销毁 PUBLISH 报头模板
+ * 
+ * @param[in] tpl  要销毁的模板，可为 NULL
+ */
+void mqtt_publish_template_destroy(mqtt_publish_template_t* tpl)
+{
+    if (NULL != tpl)
+        platform_memory_free(tpl);
+}
+
+/**
+ * @brief 按报头模板发布一条消息
+ * 
+ * 与 mqtt_publish() 相同，但主题、QoS 和 retain 标志取自模板（覆盖 msg 中的值），
+ * 报头直接由模板生成，只需写入剩余长度和报文 ID。
+ * 
+ * @param[in] c    指向 MQTT 客户端实例的指针
+ * @param[in] tpl  由 mqtt_publish_template_create() 创建的模板
+ * @param[in] msg  待发布的消息
+ * @return 见 mqtt_publish()，模板为空时返回 MQTT_NULL_VALUE_ERROR
+ */
+int mqtt_publish_by_template(mqtt_client_t* c, const mqtt_publish_template_t* tpl, mqtt_message_t* msg)
+{
+    if ((NULL == c) || (NULL == tpl) || (NULL == msg))
+        RETURN_ERROR(MQTT_NULL_VALUE_ERROR);
+
+    msg->qos = tpl->qos;
+    msg->retained = tpl->retained;
+
+    return mqtt_publish_message(c, NULL, tpl, msg);
+}
+
+#ifdef MQTT_USING_PUBLISH_ASYNC
+
+/**
+ * @brief 异步发布一条 MQTT 消息
+ * 
+ * 只把主题和负载复制到客户端的发布队列后立即返回，不访问网络、不等待写锁。
+ * 队列由 mqtt_yield_thread（或事件循环）按入队顺序发送；待确认的 QoS1/QoS2 消息
+ * 达到发送窗口大小（mqtt_set_inflight_max()）时暂停发送，收到 ACK 后继续。
+ * 事件循环模式下入队后立即唤醒事件循环发送；使用 mqtt_yield_thread 时，客户端空闲一段时间后
+ * 入队的第一条消息要等到该线程本次读等待结束（收到报文或最长 mqtt_cmd_timeout）才发出，
+ * 之后连续入队的消息在 MQTT_PUBLISH_QUEUE_TICK 内发出。
+ * 
+ * 完成回调在客户端线程中调用，result 为：
+ *   - QoS0: 报文写入网络的结果；启用 MQTT_USING_WRITER_THREAD 时为报文交给写线程的结果，
+ *           回调在报文真正写出之前调用，之后连接断开时该报文会被丢弃而不再通知
+ *   - QoS1: 收到 PUBACK 时为 MQTT_SUCCESS_ERROR
+ *   - QoS2: 收到 PUBCOMP 时为 MQTT_SUCCESS_ERROR
+ *   - 发送失败或会话被清理时为相应的错误码（发送途中连接断开不算失败，消息留在队列中重连后重发）
+ * 
+ * @param[in] c             指向 MQTT 客户端实例的指针
+ * @param[in] topic_filter  发布的主题
+ * @param[in] msg           消息，payloadlen 为 0 时按字符串计算长度；调用返回后即可复用
+ * @param[in] handler       完成回调，可为 NULL
+ * @param[in] arg           传递给完成回调的用户参数
+ * @return 
+ *   - MQTT_SUCCESS_ERROR: 已入队
+ *   - MQTT_NULL_VALUE_ERROR: 参数为空
+ *   - MQTT_BUFFER_TOO_SHORT_ERROR: 负载超出协议允许的最大长度
+ *   - MQTT_MEM_NOT_ENOUGH_ERROR: 内存不足
+ *   - MQTT_PUBLISH_QUEUE_FULL_ERROR: 队列中已有 MQTT_PUBLISH_QUEUE_MAX 条消息
+ */
+int mqtt_publish_async(mqtt_client_t* c, const char* topic_filter, mqtt_message_t* msg, publish_handler_t handler, void* arg)
+{
+    size_t topic_len, payload_len;
+    mqtt_publish_request_t *req;
+
+    if ((NULL == c) || (NULL == topic_filter) || (NULL == msg))
+        RETURN_ERROR(MQTT_NULL_VALUE_ERROR);
+
+    payload_len = msg->payloadlen;
+    if ((NULL != msg->payload) && (0 == payload_len))
+        payload_len = strlen((char*)msg->payload);
+
+    if (payload_len > MQTT_MAX_PAYLOAD_SIZE)
+        RETURN_ERROR(MQTT_BUFFER_TOO_SHORT_ERROR);
+
+    /* 请求、主题和负载一次分配 */
+    topic_len = strlen(topic_filter) + 1;
+    req = (mqtt_publish_request_t *)MQTT_OBJECT_ALLOC(c, sizeof(mqtt_publish_request_t) + topic_len + payload_len);
+    MQTT_ROBUSTNESS_CHECK(req, MQTT_MEM_NOT_ENOUGH_ERROR);
+
+    req->handler = handler;
+    req->arg = arg;
+    req->topic = (char *)(req + 1);
+    memcpy(req->topic, topic_filter, topic_len);
+    req->message = *msg;
+    req->message.payload = req->topic + topic_len;
+    req->message.payloadlen = payload_len;
+    if (payload_len > 0)
+        memcpy(req->message.payload, msg->payload, payload_len);
+    mqtt_list_init(&req->list);
+
+    platform_mutex_lock(&c->mqtt_publish_queue_lock);
+    if (c->mqtt_publish_queue_number >= MQTT_PUBLISH_QUEUE_MAX) {
+        platform_mutex_unlock(&c->mqtt_publish_queue_lock);
+        MQTT_OBJECT_FREE(c, req);
+        RETURN_ERROR(MQTT_PUBLISH_QUEUE_FULL_ERROR);
     }
+    mqtt_list_add_tail(&req->list, &c->mqtt_publish_queue);
+    c->mqtt_publish_queue_number++;
+    platform_mutex_unlock(&c->mqtt_publish_queue_lock);
+
+#ifdef MQTT_USING_REACTOR
+    /* 让事件循环立即发送该客户端的队列，而不是等到下一次 tick */
+    mqtt_reactor_wakeup(&c->mqtt_reactor_node);
+#endif
+
+    RETURN_ERROR(MQTT_SUCCESS_ERROR);
+}
+
+#endif /* MQTT_USING_PUBLISH_ASYNC */
+
+#ifdef MQTT_USING_PUBLISH_STREAM
+
+/**
+ * @brief 发布一条负载来自文件或读取回调的 MQTT 消息
+ * 
+ * 负载不需要一次放在内存中：报头序列化到写缓冲区后，写缓冲区剩余的空间用作中转，
+ * 负载分段读取、分段写出；数据源是文件且连接是明文 TCP 时用 sendfile 发送，不经过用户态。
+ * QoS1/QoS2 消息的 ACK 处理器只保存报头和数据源，超时或重连后从数据源重新读取负载重发。
+ * 
+ * 完成回调在负载不再被读取之后调用，之后才可以关闭文件或释放数据源，result 为：
+ *   - QoS0: 报文写出后为 MQTT_SUCCESS_ERROR
+ *   - QoS1: 收到 PUBACK 时为 MQTT_SUCCESS_ERROR
+ *   - QoS2: 收到 PUBCOMP 时为 MQTT_SUCCESS_ERROR
+ *   - 会话被清理时为 MQTT_CLEAN_SESSION_ERROR
+ * 
+ * @param[in] c             指向 MQTT 客户端实例的指针
+ * @param[in] topic_filter  发布的主题
+ * @param[in] msg           消息，payloadlen 为负载总长度，payload 不使用；QoS1/QoS2 时 msg->id 会被设置
+ * @param[in] source        负载数据源，会被拷贝，但它引用的文件或用户参数必须保持有效
+ * @param[in] handler       完成回调，可为 NULL
+ * @param[in] arg           传递给完成回调的用户参数
+ * @return 
+ *   - MQTT_SUCCESS_ERROR: 发送成功
+ *   - MQTT_NOT_SUPPORT_ERROR: 数据源是文件，但当前连接（TLS）或平台不支持 sendfile，应改用读取回调
+ *   - MQTT_PUBLISH_PACKET_ERROR: 读取回调第一次读取就失败，没有发送任何数据
+ *   - 其他错误码: 发送失败，此时不会调用 handler；报文写出一部分后失败会断开连接
+ */
+int mqtt_publish_stream(mqtt_client_t* c, const char* topic_filter, mqtt_message_t* msg, mqtt_publish_source_t* source, publish_handler_t handler, void* arg)
+{
+    int len = 0;
+    int type;
+    int rc = MQTT_FAILED_ERROR;
+    platform_timer_t timer;
+    mqtt_iovec_t head;
+    ack_handlers_t *ack_handler;
+    publish_handler_t done = NULL;
+    MQTTString topic = MQTTString_initializer;
+    topic.cstring = (char *)topic_filter;
+
+    if ((NULL == c) || (NULL == topic_filter) || (NULL == msg) || (NULL == source))
+        RETURN_ERROR(MQTT_NULL_VALUE_ERROR);
+
+    if ((source->fd < 0) && (NULL == source->read))
+        RETURN_ERROR(MQTT_NULL_VALUE_ERROR);
+
+    if (CLIENT_STATE_CONNECTED != mqtt_get_client_state(c))
+        RETURN_ERROR(MQTT_NOT_CONNECT_ERROR);
+
+    if (msg->payloadlen > MQTT_MAX_PAYLOAD_SIZE)
+        RETURN_ERROR(MQTT_BUFFER_TOO_SHORT_ERROR);
+
+    if ((source->fd >= 0) && (!network_sendfile_is_supported(c->mqtt_network)))
+        RETURN_ERROR(MQTT_NOT_SUPPORT_ERROR);
 
-    // 加锁，防止多线程并发写入网络缓冲区
     platform_mutex_lock(&c->mqtt_write_lock);
 
-    // 对于 QoS > 0 的消息，需要记录 ACK 处理器以便重传
     if (QOS0 != msg->qos) {
-        // 检查当前待确认的消息数量是否已达最大限制
-        if (mqtt_ack_handler_is_maximum(c)) {
-            rc = MQTT_ACK_HANDLER_NUM_TOO_MUCH_ERROR; /* 已达到最大记录数 */
-            goto exit; // 跳转至清理和解锁
+        if ((rc = mqtt_inflight_wait(c, c->mqtt_inflight_timeout)) != MQTT_SUCCESS_ERROR)
+            goto exit;
+        if (0 == (msg->id = mqtt_get_next_packet_id(c))) {
+            rc = MQTT_ACK_HANDLER_NUM_TOO_MUCH_ERROR;
+            goto exit;
         }
-        // 获取下一个可用的报文 ID（用于 QoS1/QoS2 的消息匹配）
-        msg->id = mqtt_get_next_packet_id(c);
     }
-    
-    /* 序列化 PUBLISH 报文到写缓冲区 */
-    len = MQTTSerialize_publish(
-              c->mqtt_write_buf,      // 输出缓冲区
-              c->mqtt_write_buf_size, // 缓冲区大小
-              0,                      // dup 标志（初始为 0，后面可能设置）
-              msg->qos,               // QoS 级别
-              msg->retained,          // retain 标志
-              msg->id,                // 报文 ID（QoS0 可为 0）
-              topic,                  // 主题
-              (uint8_t*)msg->payload, // 负载数据
-              msg->payloadlen         // 负载长度
-          );
 
-    // 序列化失败（返回值 <= 0），直接跳转退出
-    if (len <= 0)
-        goto exit;
-    
-    // 将序列化后的数据通过网络发送
-    if ((rc = mqtt_send_packet(c, len, &timer)) != MQTT_SUCCESS_ERROR)
-        goto exit; // 发送失败，跳转退出
-    
-    // 如果是 QoS1 或 QoS2，需要等待对方确认，并准备重传机制
-    if (QOS0 != msg->qos) {
-        mqtt_set_publish_dup(c, 1);  /* 设置 DUP 标志，表示此消息可能重发 */
+    len = MQTTSerialize_publishHeader(c->mqtt_write_buf, c->mqtt_write_buf_size, 0, msg->qos, 
+                                      msg->retained, msg->id, topic, msg->payloadlen);
 
-        if (QOS1 == msg->qos) {
-            /* 期望收到 PUBACK 确认，否则将重发 */
-            rc = mqtt_ack_list_record(c, PUBACK, msg->id, len, NULL);  
-            
-        } else if (QOS2 == msg->qos) {
-            /* 期望收到 PUBREC 确认，否则将重发 */
-            rc = mqtt_ack_list_record(c, PUBREC, msg->id, len, NULL);   
-        }
-        // 注意：这里 rc 是记录 ack handler 的结果，若失败仍继续执行
+    /* 写缓冲区剩余的空间用作负载的中转缓冲区，至少要能放下一个字节 */
+    if ((len <= 0) || ((msg->payloadlen > 0) && (len >= (int)c->mqtt_write_buf_size))) {
+        rc = MQTT_BUFFER_TOO_SHORT_ERROR;
+        goto exit;
     }
-    
-exit:
-    msg->payloadlen = 0;        // 清空 payload 长度，防止误用
 
-    platform_mutex_unlock(&c->mqtt_write_lock); // 释放写锁
+    head.buf = c->mqtt_write_buf;
+    head.len = len;
+    rc = mqtt_publish_stream_send(c, &head, source, (uint32_t)msg->payloadlen, 
+                                  c->mqtt_write_buf + len, c->mqtt_write_buf_size - len, &timer);
+    if (MQTT_SUCCESS_ERROR != rc)
+        goto exit;
 
-    // 特殊错误处理：若因资源不足导致发布失败
-    if ((MQTT_ACK_HANDLER_NUM_TOO_MUCH_ERROR == rc) || 
-        (MQTT_MEM_NOT_ENOUGH_ERROR == rc)) {
-        MQTT_LOG_W("%s:%d %s()... there is not enough memory space to record...", 
-                   __FILE__, __LINE__, __FUNCTION__);
+    /* QoS0 发送完成即结束，回调在释放写锁之后调用，回调中可以再次发布 */
+    if (QOS0 == msg->qos) {
+        done = handler;
+        goto exit;
+    }
 
-        /* 释放底层网络文件描述符（避免资源泄漏） */
-        network_release(c->mqtt_network);
-        
-        /* 标记客户端为断开状态，建议上层重新连接 */
-        mqtt_set_client_state(c, CLIENT_STATE_DISCONNECTED);
+    mqtt_set_publish_dup(c, 1);
+
+    /* 只保存报头，负载在重发时从数据源重新读取 */
+    type = (QOS1 == msg->qos) ? PUBACK : PUBREC;
+    rc = mqtt_ack_list_record(c, type, msg->id, len, NULL, 0, NULL);
+    if (MQTT_SUCCESS_ERROR == rc) {
+        ack_handler = mqtt_ack_list_find(c, type, msg->id);
+        ack_handler->source_len = (uint32_t)msg->payloadlen;
+        ack_handler->source = *source;
+        ack_handler->publish_handler = handler;
+        ack_handler->publish_arg = arg;
     }
 
-    RETURN_ERROR(rc);     // 使用宏返回最终结果（可能包含日志）
+exit:
+    platform_mutex_unlock(&c->mqtt_write_lock);
+
+    if (NULL != done)
+        done(c, arg, MQTT_SUCCESS_ERROR);
+
+    RETURN_ERROR(rc);
 }
 
+#endif /* MQTT_USING_PUBLISH_STREAM */
+
 
 /**
  * @brief 列出所有已订阅的主题
@@ -2355,6 +4686,191 @@ int mqtt_list_subscribe_topic(mqtt_client_t* c)
     RETURN_ERROR(MQTT_SUCCESS_ERROR);
 }
 
+/**
+ * @brief 获取测量得到的往返时间
+ *
+ * 往返时间由 QoS1/QoS2 报文从发送到收到 PUBACK/PUBREC/PUBCOMP 的时间测得，
+ * 还没有测量值时 srtt、rttvar 为 0，rto 为 mqtt_cmd_timeout。
+ *
+ * @param[in]  c       指向 MQTT 客户端实例的指针
+ * @param[out] srtt    平滑往返时间（毫秒），可为 NULL
+ * @param[out] rttvar  往返时间偏差（毫秒），可为 NULL
+ * @param[out] rto     当前的重发超时（毫秒），可为 NULL
+ * @return
+ *   - MQTT_SUCCESS_ERROR: 获取成功
+ *   - MQTT_NULL_VALUE_ERROR: 参数为空
+ */
+int mqtt_get_rtt(mqtt_client_t* c, uint32_t* srtt, uint32_t* rttvar, uint32_t* rto)
+{
+    if (NULL == c)
+        RETURN_ERROR(MQTT_NULL_VALUE_ERROR);
+
+    platform_mutex_lock(&c->mqtt_write_lock);
+    if (NULL != srtt)
+        *srtt = c->mqtt_srtt >> 3;
+    if (NULL != rttvar)
+        *rttvar = c->mqtt_rttvar >> 2;
+    if (NULL != rto)
+        *rto = (0 != c->mqtt_rto) ? c->mqtt_rto : c->mqtt_cmd_timeout;
+    platform_mutex_unlock(&c->mqtt_write_lock);
+
+    RETURN_ERROR(MQTT_SUCCESS_ERROR);
+}
+
+/**
+ * @brief 获取客户端的连接状态和待确认报文数
+ *
+ * 供其他线程（如客户端组的统计）读取，二者都在全局锁下读取。
+ *
+ * @param[in]  c         指向 MQTT 客户端实例的指针
+ * @param[out] state     当前客户端状态（CLIENT_STATE_*），可为 NULL
+ * @param[out] inflight  等待确认的报文数，可为 NULL
+ * @return
+ *   - MQTT_SUCCESS_ERROR: 获取成功
+ *   - MQTT_NULL_VALUE_ERROR: 参数为空
+ */
+int mqtt_get_state(mqtt_client_t* c, client_state_t* state, uint32_t* inflight)
+{
+    if (NULL == c)
+        RETURN_ERROR(MQTT_NULL_VALUE_ERROR);
+
+    platform_mutex_lock(&c->mqtt_global_lock);
+    if (NULL != state)
+        *state = c->mqtt_client_state;
+    if (NULL != inflight)
+        *inflight = c->mqtt_ack_handler_number;
+    platform_mutex_unlock(&c->mqtt_global_lock);
+
+    RETURN_ERROR(MQTT_SUCCESS_ERROR);
+}
+
+/**
+ * @brief 设置客户端的重连策略
+ *
+ * 新策略从下一次重连失败时开始生效，已经计算出的等待时间不受影响。
+ *
+ * @param[in] c       指向 MQTT 客户端实例的指针
+ * @param[in] policy  重连策略，cap 小于 base 时按 base 处理
+ * @return
+ *   - MQTT_SUCCESS_ERROR: 设置成功
+ *   - MQTT_NULL_VALUE_ERROR: 参数为空
+ */
+int mqtt_set_reconnect_policy(mqtt_client_t* c, const mqtt_reconnect_policy_t* policy)
+{
+    if ((NULL == c) || (NULL == policy))
+        RETURN_ERROR(MQTT_NULL_VALUE_ERROR);
+
+    platform_mutex_lock(&c->mqtt_global_lock);
+    c->mqtt_reconnect_policy = *policy;
+    platform_mutex_unlock(&c->mqtt_global_lock);
+
+    RETURN_ERROR(MQTT_SUCCESS_ERROR);
+}
+
+/**
+ * @brief 获取客户端的重连统计
+ *
+ * @param[in]  c      指向 MQTT 客户端实例的指针
+ * @param[out] stats  重连统计
+ * @return
+ *   - MQTT_SUCCESS_ERROR: 获取成功
+ *   - MQTT_NULL_VALUE_ERROR: 参数为空
+ */
+int mqtt_get_reconnect_stats(mqtt_client_t* c, mqtt_reconnect_stats_t* stats)
+{
+    if ((NULL == c) || (NULL == stats))
+        RETURN_ERROR(MQTT_NULL_VALUE_ERROR);
+
+    platform_mutex_lock(&c->mqtt_global_lock);
+    *stats = c->mqtt_reconnect_stats;
+    platform_mutex_unlock(&c->mqtt_global_lock);
+
+    RETURN_ERROR(MQTT_SUCCESS_ERROR);
+}
+
+/**
+ * @brief 添加一个服务器端点
+ *
+ * 配置了端点后，每次连接和重连都从端点列表中选择：优先选择没有被暂停且延迟（PINGRESP 往返时间，
+ * 没有时使用连接延迟）最低的端点。端点连接失败或连接断开后暂停 MQTT_ENDPOINT_RETRY_INTERVAL 毫秒，
+ * 连续失败时暂停时间加倍；还有可用端点时重连失败会立即切换，不进行退避。
+ *
+ * @param[in] c     指向 MQTT 客户端实例的指针
+ * @param[in] host  服务器地址，只保存指针，调用者需保证其在客户端释放前有效
+ * @param[in] port  服务器端口，同上
+ * @return
+ *   - MQTT_SUCCESS_ERROR: 添加成功
+ *   - MQTT_NULL_VALUE_ERROR: 参数为空
+ *   - MQTT_MEM_NOT_ENOUGH_ERROR: 内存不足
+ *
+ * @note 配置端点后 mqtt_set_host() 和 mqtt_set_port() 设置的地址不再使用。
+ */
+int mqtt_add_endpoint(mqtt_client_t* c, char* host, char* port)
+{
+    mqtt_endpoint_t *endpoints;
+
+    if ((NULL == c) || (NULL == host) || (NULL == port))
+        RETURN_ERROR(MQTT_NULL_VALUE_ERROR);
+
+    platform_mutex_lock(&c->mqtt_global_lock);
+
+    endpoints = (mqtt_endpoint_t *)platform_memory_alloc((c->mqtt_endpoint_number + 1) * sizeof(mqtt_endpoint_t));
+    if (NULL == endpoints) {
+        platform_mutex_unlock(&c->mqtt_global_lock);
+        RETURN_ERROR(MQTT_MEM_NOT_ENOUGH_ERROR);
+    }
+
+    if (NULL != c->mqtt_endpoints) {
+        memcpy(endpoints, c->mqtt_endpoints, c->mqtt_endpoint_number * sizeof(mqtt_endpoint_t));
+        platform_memory_free(c->mqtt_endpoints);
+    }
+
+    memset(&endpoints[c->mqtt_endpoint_number], 0, sizeof(mqtt_endpoint_t));
+    endpoints[c->mqtt_endpoint_number].host = host;
+    endpoints[c->mqtt_endpoint_number].port = port;
+    endpoints[c->mqtt_endpoint_number].down_until = platform_timer_now();
+
+    c->mqtt_endpoints = endpoints;
+    c->mqtt_endpoint_number++;
+
+    platform_mutex_unlock(&c->mqtt_global_lock);
+
+    RETURN_ERROR(MQTT_SUCCESS_ERROR);
+}
+
+/**
+ * @brief 获取服务器端点的延迟和健康统计
+ *
+ * @param[in]  c      指向 MQTT 客户端实例的指针
+ * @param[in]  index  端点下标（添加顺序），小于 0 表示当前使用的端点
+ * @param[out] ep     端点统计
+ * @return
+ *   - MQTT_SUCCESS_ERROR: 获取成功
+ *   - MQTT_NULL_VALUE_ERROR: 参数为空
+ *   - MQTT_FAILED_ERROR: 端点不存在
+ */
+int mqtt_get_endpoint(mqtt_client_t* c, int index, mqtt_endpoint_t* ep)
+{
+    int rc = MQTT_FAILED_ERROR;
+
+    if ((NULL == c) || (NULL == ep))
+        RETURN_ERROR(MQTT_NULL_VALUE_ERROR);
+
+    platform_mutex_lock(&c->mqtt_global_lock);
+
+    if (index < 0)
+        index = c->mqtt_endpoint_current;
+
+    if ((index >= 0) && ((uint32_t)index < c->mqtt_endpoint_number)) {
+        *ep = c->mqtt_endpoints[index];
+        rc = MQTT_SUCCESS_ERROR;
+    }
+
+    platform_mutex_unlock(&c->mqtt_global_lock);
+
+    RETURN_ERROR(rc);
+}
+
 /**
  * @brief 设置遗嘱消息选项
  * 
@@ -23,6 +23,16 @@
 #include "random.h"
 #include "mqtt_error.h"
 #include "mqtt_log.h"
+#ifdef MQTT_USING_REACTOR
+#include "mqtt_reactor.h"
+#endif
+#include "mqtt_wheel.h"
+#include "mqtt_topic_tree.h"
+#include "mqtt_pool.h"
+#ifdef MQTT_USING_WRITER_THREAD
+#include "mqtt_ring.h"
+#include "platform_event.h"
+#endif
 
 #ifdef __cplusplus
 extern "C" {
@@ -71,22 +81,155 @@ typedef struct mqtt_message {
  * @brief 消息数据包装结构体
  *
  * 将消息的主题名称与消息内容打包在一起，便于传递给消息处理回调函数。
+ * topic/topic_len 与 message->payload/payloadlen 直接指向接收缓冲区，只在回调期间有效。
+ *
+ * @note 启用 MQTT_USING_ZERO_COPY_DELIVERY 时不填充 topic_name（为空字符串），负载也不以 '\0' 结尾，
+ *       回调必须按长度访问主题和负载，适合二进制负载。
  */
 typedef struct message_data {
-    char                topic_name[MQTT_TOPIC_LEN_MAX];  ///< 主题名称（以 '\0' 结尾的字符串）
+    char                topic_name[MQTT_TOPIC_LEN_MAX];  ///< 主题名称（以 '\0' 结尾的字符串，过长会被截断）
+    const char          *topic;                          ///< 主题，不以 '\0' 结尾
+    uint16_t            topic_len;                       ///< 主题长度（字节）
     mqtt_message_t      *message;                        ///< 指向实际消息内容的指针
 } message_data_t;
 
 typedef void (*interceptor_handler_t)(void* client, message_data_t* msg);
 typedef void (*message_handler_t)(void* client, message_data_t* msg);
 typedef void (*reconnect_handler_t)(void* client, void* reconnect_date);
+typedef void (*publish_handler_t)(void* client, void* arg, int result);
+
+/**
+ * @brief 重连退避的随机抖动方式
+ */
+typedef enum mqtt_backoff_jitter {
+    MQTT_BACKOFF_JITTER_NONE = 0,       ///< 不抖动：第 n 次失败后等待 min(cap, base * 2^(n-1))
+    MQTT_BACKOFF_JITTER_FULL,           ///< 完全抖动：在 [0, min(cap, base * 2^(n-1))] 内均匀取值
+    MQTT_BACKOFF_JITTER_DECORRELATED    ///< 去相关抖动：在 [base, min(cap, 上一次等待时间 * 3)] 内均匀取值
+} mqtt_backoff_jitter_t;
+
+/**
+ * @brief 重连熔断器状态
+ */
+typedef enum mqtt_breaker_state {
+    MQTT_BREAKER_CLOSED = 0,            ///< 正常按退避策略重连
+    MQTT_BREAKER_OPEN,                  ///< 连续失败次数达到阈值，冷却期内不重连
+    MQTT_BREAKER_HALF_OPEN              ///< 冷却期结束，正在进行一次试探重连，失败后重新熔断
+} mqtt_breaker_state_t;
+
+/**
+ * @brief 重连策略
+ *
+ * 每次重连失败后按指数退避计算下一次重连前的等待时间，并加入随机抖动，
+ * 避免服务器重启后大量设备同时、同步地重连。
+ *
+ * @see mqtt_set_reconnect_policy()
+ */
+typedef struct mqtt_reconnect_policy {
+    uint32_t                base;               ///< 退避的初始等待时间（毫秒）
+    uint32_t                cap;                ///< 等待时间上限（毫秒）
+    mqtt_backoff_jitter_t   jitter;             ///< 随机抖动方式
+    uint32_t                breaker_threshold;  ///< 连续失败多少次后熔断，0 表示不使用熔断器
+    uint32_t                breaker_cooldown;   ///< 熔断后的冷却时间（毫秒），实际取值在 [cooldown / 2, cooldown] 内
+} mqtt_reconnect_policy_t;
+
+/**
+ * @brief 重连统计
+ *
+ * @see mqtt_get_reconnect_stats()
+ */
+typedef struct mqtt_reconnect_stats {
+    uint32_t                attempts;           ///< 累计重连次数
+    uint32_t                successes;          ///< 累计重连成功次数
+    uint32_t                failures;           ///< 累计重连失败次数
+    uint32_t                consecutive;        ///< 当前连续失败次数，重连成功后清零
+    uint32_t                delay;              ///< 最近一次失败后计算出的等待时间（毫秒）
+    uint32_t                breaker_trips;      ///< 熔断次数（含试探失败后再次熔断）
+    mqtt_breaker_state_t    breaker;            ///< 熔断器当前状态
+} mqtt_reconnect_stats_t;
+
+/**
+ * @brief 服务器端点及其测量结果
+ *
+ * 配置了多个端点时，每次连接选择没有被暂停、延迟最小的端点，
+ * 连接失败或连接断开的端点暂停一段时间，期间立即切换到其他端点。
+ *
+ * @see mqtt_add_endpoint(), mqtt_get_endpoint()
+ */
+typedef struct mqtt_endpoint {
+    char                    *host;              ///< 服务器地址
+    char                    *port;              ///< 服务器端口
+    uint32_t                connect_rtt;        ///< 平滑后的连接延迟：开始建立连接到收到 CONNACK（毫秒）
+    uint32_t                ping_rtt;           ///< 平滑后的 PINGREQ 到 PINGRESP 往返时间（毫秒）
+    uint32_t                connects;           ///< 累计连接成功次数，为 0 时 connect_rtt 无效
+    uint32_t                pings;              ///< 累计收到的 PINGRESP 个数，为 0 时 ping_rtt 无效
+    uint32_t                failures;           ///< 连续失败次数（连接失败或连接断开），连接成功后清零
+    unsigned long           down_until;         ///< 暂停到该时间点（platform_timer_now() 毫秒数），之前不优先选择
+} mqtt_endpoint_t;
+
+#ifdef MQTT_USING_STREAM_RECEIVE
+/**
+ * @brief 流式接收事件
+ *
+ * 超过接收缓冲区大小的 PUBLISH 报文不再被丢弃，而是边接收边通过流式回调交给用户。
+ */
+typedef enum mqtt_stream_event {
+    MQTT_STREAM_BEGIN = 0,      ///< 开始接收：msg->topic 有效，msg->message->payloadlen 为负载总长度，payload 为 NULL
+    MQTT_STREAM_CHUNK,          ///< 收到一段负载：msg->message->payload/payloadlen 指向接收缓冲区中的这一段
+    MQTT_STREAM_END,            ///< 负载接收完毕，之后回复 PUBACK/PUBREC
+    MQTT_STREAM_ABORT           ///< 连接断开，负载没有接收完整（QoS1/QoS2 消息会被服务器重发）
+} mqtt_stream_event_t;
+
+typedef void (*stream_handler_t)(void* client, message_data_t* msg, mqtt_stream_event_t event);
+#endif
+
+/**
+ * @brief 预先序列化的 PUBLISH 报头模板
+ *
+ * 为固定的主题、QoS 和 retain 标志缓存固定报头的第一个字节和编码后的主题（2 字节长度前缀 + 主题），
+ * 发布时只需写入剩余长度和报文 ID，不再对主题调用 strlen、计算报文长度和序列化主题。
+ * 模板创建后只读，可以在多个线程、多个客户端之间共享。
+ *
+ * @see mqtt_publish_template_create(), mqtt_publish_by_template()
+ */
+typedef struct mqtt_publish_template {
+    uint8_t             flags;           ///< 固定报头的第一个字节（报文类型、QoS、retain）
+    uint8_t             retained;        ///< retain 标志
+    mqtt_qos_t          qos;             ///< QoS 级别
+    uint32_t            topic_len;       ///< 编码后的主题长度（含长度前缀）
+    uint8_t             *topic;          ///< 编码后的主题，与模板一起分配
+} mqtt_publish_template_t;
+
+#ifdef MQTT_USING_PUBLISH_STREAM
+/**
+ * @brief 流式发布的负载读取回调
+ *
+ * 从负载的 offset 处读取最多 len 字节到 buf。QoS1/QoS2 消息重发时会从 offset 0 重新读取，
+ * 因此数据源必须能按偏移重复读取。
+ *
+ * @return 实际读取的字节数（> 0），<= 0 表示读取失败
+ */
+typedef int (*publish_read_t)(void* arg, uint32_t offset, uint8_t* buf, uint32_t len);
+
+/**
+ * @brief 流式发布的负载数据源
+ *
+ * fd >= 0 时从文件 fd 的 offset 处开始发送（明文 TCP 上用 sendfile，不经过用户态），
+ * 否则通过 read 回调分段读取。数据源必须保持有效，直到发布的完成回调被调用。
+ */
+typedef struct mqtt_publish_source {
+    int                 fd;              ///< 文件描述符，不使用时为 -1
+    uint32_t            offset;          ///< 负载在文件中的起始偏移（仅 fd 有效）
+    publish_read_t      read;            ///< 负载读取回调（fd < 0 时使用）
+    void                *arg;            ///< 传递给读取回调的用户参数
+} mqtt_publish_source_t;
+#endif
 
 /**
  * @brief MQTT 消息处理器结构体
  *
  * 该结构体用于注册和管理针对特定主题过滤器（topic filter）的消息回调函数。
  * 客户端通过该结构将主题与对应的处理函数（handler）关联起来，当收到匹配主题的消息时，
- * 会遍历处理器列表并调用相应的回调函数。
+ * 通过主题树找到所有匹配的处理器并依次调用它们的回调函数。
  *
  * 此结构通常作为节点插入链表（由 mqtt_list_t 管理），实现多主题订阅的回调分发机制。
  *
@@ -104,6 +247,17 @@ typedef struct message_handlers {
     message_handler_t   handler;         ///< 消息到达时调用的回调函数指针
 } message_handlers_t;
 
+/**
+ * @brief 订阅请求，mqtt_subscribe_many() 一次订阅多个主题时使用
+ *
+ * @see mqtt_subscribe_many()
+ */
+typedef struct mqtt_subscription {
+    const char          *topic_filter;   ///< 主题过滤器，订阅期间必须保持有效
+    mqtt_qos_t          qos;             ///< 请求的 QoS 级别
+    message_handler_t   handler;         ///< 消息回调，为 NULL 时使用默认处理器
+} mqtt_subscription_t;
+
 /**
  * @brief MQTT 确认（ACK）处理句柄结构体
  *
@@ -118,20 +272,47 @@ typedef struct message_handlers {
  *   - 必须在收到对应 ACK 报文或超时后及时释放资源，防止内存泄漏
  *   - payload 可能为 NULL（如 PUBLISH 不带载荷，但 SUBSCRIBE 需要）
  *   - packet_id 必须全局唯一（在当前会话中）
- *   - timer 用于实现超时重传机制
+ *   - timer 挂在客户端的 ACK 时间轮上，用于实现超时重传机制
+ *   - 待确认列表、索引和时间轮都由 mqtt_write_lock 保护
  *
- * @see mqtt_list_t, platform_timer_t, message_handlers_t
+ * @see mqtt_list_t, mqtt_wheel_node_t, message_handlers_t
  */
 typedef struct ack_handlers {
     mqtt_list_t         list;            ///< 链表节点，用于将多个 ACK 处理器链接成待确认列表
-    platform_timer_t    timer;           ///< 超时定时器，用于控制重传或失败判定
+    mqtt_list_t         hash;            ///< 索引节点，挂在 packet_id 对应的索引桶上，用于常数时间匹配响应
+    mqtt_wheel_node_t   timer;           ///< 超时定时器节点，挂在 ACK 时间轮上，用于控制重传或失败判定
     uint32_t            type;            ///< 报文类型（如 PUBACK_TYPE、SUBACK_TYPE 等），用于匹配响应
     uint16_t            packet_id;       ///< 报文标识符（Packet ID），用于匹配请求与响应
     message_handlers_t  *handler;        ///< 关联的消息处理器（主要用于 SUBSCRIBE/UNSUBSCRIBE）
-    uint16_t            payload_len;     ///< 有效载荷长度（用于重传时重新发送原始数据）
-    uint8_t             *payload;        ///< 指向原始报文有效载荷的指针（用于重传）
+    uint32_t            payload_len;     ///< 有效载荷长度（用于重传时重新发送原始数据）
+    uint8_t             *payload;        ///< 指向原始报文有效载荷的指针（用于重传）；SUBACK 保存的是本次订阅创建的消息处理器指针数组
+    publish_handler_t   publish_handler; ///< 异步发布的完成回调（收到 PUBACK/PUBCOMP 时调用），可为 NULL
+    void                *publish_arg;    ///< 传递给完成回调的用户参数
+    unsigned long       sent;            ///< 最近一次发送的时间（毫秒），收到响应时用于测量往返时间
+    uint32_t            retries;         ///< 已重发的次数，每重发一次超时时间加倍，重发过的报文不参与测量
+#ifdef MQTT_USING_PUBLISH_STREAM
+    uint32_t            source_len;      ///< 流式发布的负载长度，为 0 时 payload 中保存的是完整报文
+    mqtt_publish_source_t source;        ///< 流式发布的数据源，重发时从这里重新读取负载
+#endif
 } ack_handlers_t;
 
+/**
+ * @brief 异步发布请求
+ *
+ * mqtt_publish_async() 把主题和负载拷贝到请求中后挂到客户端的发布队列上立即返回，
+ * 由后台线程（或事件循环）负责发送。QoS0 消息发送后调用完成回调，
+ * QoS1/QoS2 消息的回调随 ACK 处理器保存，收到 PUBACK/PUBCOMP 时调用。
+ *
+ * @see mqtt_publish_async()
+ */
+typedef struct mqtt_publish_request {
+    mqtt_list_t         list;            ///< 链表节点，挂载在客户端的发布队列上
+    publish_handler_t   handler;         ///< 完成回调，可为 NULL
+    void                *arg;            ///< 传递给完成回调的用户参数
+    char                *topic;          ///< 主题（拷贝，与请求一起分配）
+    mqtt_message_t      message;         ///< 消息（负载为拷贝，与请求一起分配）
+} mqtt_publish_request_t;
+
 /**
  * @brief MQTT 遗嘱（Will）消息配置选项
  *
@@ -182,36 +363,93 @@ typedef struct mqtt_client {
     uint8_t                     *mqtt_read_buf;            ///< 接收缓冲区，用于存储从网络读取的原始 MQTT 报文
     uint8_t                     *mqtt_write_buf;           ///< 发送缓冲区，用于序列化 MQTT 报文后再发送
     uint16_t                    mqtt_keep_alive_interval;  ///< Keep-Alive 间隔（秒），用于检测连接健康状态
-    uint16_t                    mqtt_packet_id;            ///< 当前使用的报文 ID（Packet ID），用于 QoS1+ 报文匹配
+    uint32_t                    mqtt_packet_id;            ///< 报文 ID 分配计数器（由 mqtt_write_lock 保护），取模后得到 QoS1+ 报文使用的报文 ID
     uint32_t                    mqtt_will_flag          : 1;  ///< 遗嘱标志（1=启用遗嘱消息）
     uint32_t                    mqtt_clean_session      : 1;  ///< Clean Session 标志（1=连接时清除会话状态）
     uint32_t                    mqtt_ping_outstanding   : 2;  ///< PING 请求未确认计数（防止重复发送 PINGREQ）
     uint32_t                    mqtt_version            : 4;  ///< MQTT 协议版本（如 3=MQTT v3.1.1, 5=MQTT v5.0）
     uint32_t                    mqtt_ack_handler_number : 24; ///< 当前待确认（ACK）处理器数量（用于限制并发）
     uint32_t                    mqtt_cmd_timeout;           ///< 命令超时时间（毫秒），用于网络读写、等待 ACK 等
+    uint32_t                    mqtt_inflight_max;          ///< 发送窗口：待确认处理器数量上限，默认 MQTT_ACK_HANDLER_NUM_MAX
+    uint32_t                    mqtt_inflight_timeout;      ///< 发送窗口已满时发布最多等待的时间（毫秒），0 表示不等待
+    uint32_t                    mqtt_srtt;                  ///< 平滑往返时间，放大 8 倍保存
+    uint32_t                    mqtt_rttvar;                ///< 往返时间偏差，放大 4 倍保存
+    uint32_t                    mqtt_rto;                   ///< 由 SRTT/RTTVAR 得到的重发超时（毫秒），0 表示使用 mqtt_cmd_timeout
     uint32_t                    mqtt_read_buf_size;         ///< 接收缓冲区大小（字节）
     uint32_t                    mqtt_write_buf_size;        ///< 发送缓冲区大小（字节）
-    uint32_t                    mqtt_reconnect_try_duration;///< 重连尝试总时长上限（毫秒）
+    uint32_t                    mqtt_read_pos;              ///< 接收缓冲区中当前报文的起始位置
+    uint32_t                    mqtt_read_end;              ///< 接收缓冲区中已缓存数据的结束位置
+    uint32_t                    mqtt_read_frame_len;        ///< 当前报文的长度，下一次读取时被消费
+    uint32_t                    mqtt_read_discard;          ///< 超出缓冲区大小的报文尚需丢弃的字节数
+    uint32_t                    mqtt_reconnect_seed;        ///< 重连抖动使用的伪随机数状态，0 表示尚未播种
     size_t                      mqtt_client_id_len;         ///< 客户端 ID 字符串长度（缓存，避免重复计算）
     size_t                      mqtt_user_name_len;         ///< 用户名长度
     size_t                      mqtt_password_len;          ///< 密码长度
 
     mqtt_will_options_t         *mqtt_will_options;         ///< 指向遗嘱消息配置的指针（可为 NULL 表示无遗嘱）
     client_state_t              mqtt_client_state;          ///< 当前客户端状态（如 CONNECTING, CONNECTED, DISCONNECTED）
+    uint8_t                     mqtt_session_present;       ///< 最近一次 CONNACK 的会话存在标志（1=服务器保留了上一次的会话，包括订阅）
 
     platform_mutex_t            mqtt_write_lock;            ///< 写操作互斥锁，防止多线程并发写网络
     platform_mutex_t            mqtt_global_lock;           ///< 全局锁，保护客户端内部状态一致性
+    platform_sem_t              mqtt_inflight_sem;          ///< 发送窗口空出位置或连接断开时唤醒等待的发布线程
+    uint32_t                    mqtt_inflight_waiters;      ///< 等待发送窗口的发布线程数（由 mqtt_global_lock 保护）
 
     mqtt_list_t                 mqtt_msg_handler_list;      ///< 消息处理器链表：存储所有订阅主题及其回调函数
+    mqtt_topic_tree_t           mqtt_msg_handler_tree;      ///< 消息处理器索引：按主题层级保存，收到消息时一次下降找到所有匹配的处理器
     mqtt_list_t                 mqtt_ack_handler_list;      ///< ACK 处理器链表：管理待确认的 QoS1+ 报文（PUB/SUB/UNSUB）
+    mqtt_list_t                 *mqtt_ack_hash;             ///< ACK 索引：按 packet_id 散列的桶，与待确认列表一起由 mqtt_write_lock 保护
+    uint32_t                    *mqtt_packet_id_map;        ///< 报文 ID 占用位图：有 ACK 处理器等待确认的本端报文 ID 置位，分配时跳过
+    mqtt_wheel_t                mqtt_ack_wheel;             ///< ACK 超时时间轮：按到期时间索引 ACK 处理器，只处理到期的节点
 
     network_t                   *mqtt_network;              ///< 网络接口抽象层指针（TCP/TLS 实现）
     platform_thread_t           *mqtt_thread;               ///< 后台工作线程指针（运行 mqtt_yield_thread）
-    platform_timer_t            mqtt_last_sent;             ///< 最后一次发送数据的时间戳（用于 Keep-Alive 判断）
-    platform_timer_t            mqtt_last_received;         ///< 最后一次接收到数据的时间戳（用于 Keep-Alive 判断）
+    unsigned long               mqtt_last_sent;             ///< 最后一次发送数据的时间戳（platform_timer_now() 毫秒数，用于 Keep-Alive 判断）
+    unsigned long               mqtt_last_received;         ///< 最后一次接收到数据的时间戳（platform_timer_now() 毫秒数，用于 Keep-Alive 判断）
+    unsigned long               mqtt_now;                   ///< 当前时间缓存：每处理一个报文读取一次时钟，保活、ACK 超时等判断共用
 
     reconnect_handler_t         mqtt_reconnect_handler;     ///< 重连成功后的回调函数（通知上层）
+    mqtt_reconnect_policy_t     mqtt_reconnect_policy;      ///< 重连退避策略
+    mqtt_reconnect_stats_t      mqtt_reconnect_stats;       ///< 重连统计，由 mqtt_global_lock 保护
+    platform_timer_t            mqtt_reconnect_timer;       ///< 下一次允许重连的时间点
+    mqtt_endpoint_t             *mqtt_endpoints;            ///< 服务器端点列表，为 NULL 时使用 mqtt_host/mqtt_port，由 mqtt_global_lock 保护
+    uint32_t                    mqtt_endpoint_number;       ///< 端点个数
+    int32_t                     mqtt_endpoint_current;      ///< 最近一次连接使用的端点，-1 表示没有
+    uint8_t                     mqtt_endpoint_live;         ///< 当前端点上的连接已经建立，断开时记为该端点的一次失败
+    unsigned long               mqtt_ping_sent;             ///< 最近一次发送 PINGREQ 的时间，用于测量 PINGRESP 往返时间
     interceptor_handler_t       mqtt_interceptor_handler;   ///< 消息拦截器（可在发送/接收前修改或记录消息）
+#ifdef MQTT_USING_REACTOR
+    mqtt_reactor_t              *mqtt_reactor;              ///< 共享的事件循环组（为 NULL 时使用独立的 mqtt_yield_thread）
+    mqtt_reactor_node_t         mqtt_reactor_node;          ///< 挂载到事件循环上的节点
+#endif
+#ifdef MQTT_USING_PUBLISH_ASYNC
+    platform_mutex_t            mqtt_publish_queue_lock;    ///< 保护异步发布队列
+    mqtt_list_t                 mqtt_publish_queue;         ///< 异步发布队列，由后台线程（或事件循环）发送
+    uint32_t                    mqtt_publish_queue_number;  ///< 队列中的请求数量，上限为 MQTT_PUBLISH_QUEUE_MAX
+#endif
+#ifdef MQTT_USING_STREAM_RECEIVE
+    stream_handler_t            mqtt_stream_handler;        ///< 流式接收回调，为 NULL 时超长报文仍被丢弃
+    message_data_t              mqtt_stream_data;           ///< 正在流式接收的消息，CHUNK 之后 topic 为 NULL（topic_name 仍有效）
+    mqtt_message_t              mqtt_stream_message;        ///< 正在流式接收的消息属性（QoS、报文 ID 等）
+    uint32_t                    mqtt_read_stream;           ///< 正在流式接收的负载尚未收到的字节数，为 0 表示没有在流式接收
+    uint8_t                     mqtt_stream_skip;           ///< 重复的 QoS2 消息，只接收不回调
+#endif
+#ifdef MQTT_USING_WRITER_THREAD
+    mqtt_ring_t                 mqtt_writer_ring;           ///< 待发送报文的无锁队列，多个线程写入，写线程读出
+    platform_event_t            mqtt_writer_event;          ///< 唤醒空闲的写线程
+    platform_event_t            mqtt_writer_space_event;    ///< 写线程取走报文后唤醒因队列满而等待的发布线程
+    platform_mutex_t            mqtt_writer_lock;           ///< 写线程发送时持有，保证与连接阶段的直接发送不交错
+    platform_thread_t           *mqtt_writer_thread;        ///< 写线程，唯一从 mqtt_writer_ring 取报文写 socket 的线程
+    uint32_t                    mqtt_writer_epoch;          ///< 连接序号，丢弃上一次连接遗留的报文
+    uint32_t                    mqtt_writer_pending;        ///< 已入队但还未写出（或丢弃）的报文数
+    uint32_t                    mqtt_writer_blocked;        ///< 因队列满而等待的发布线程数
+    uint8_t                     mqtt_writer_running;        ///< 写线程运行标志，清零后写线程退出
+    uint8_t                     mqtt_writer_sleeping;       ///< 写线程正在等待唤醒
+    uint8_t                     mqtt_writer_alive;          ///< 写线程尚未退出，退出前最后一次访问客户端时清零
+#endif
+#ifdef MQTT_USING_MEMORY_POOL
+    mqtt_pool_t                 mqtt_pool;                  ///< ACK 处理器、消息处理器、异步发布请求等频繁分配的对象使用的内存池
+#endif
 
 } mqtt_client_t;
 
@@ -311,11 +549,19 @@ MQTT_CLIENT_SET_STATEMENT(will_flag, uint32_t)
 MQTT_CLIENT_SET_STATEMENT(clean_session, uint32_t)
 MQTT_CLIENT_SET_STATEMENT(version, uint32_t)
 MQTT_CLIENT_SET_STATEMENT(cmd_timeout, uint32_t)
+MQTT_CLIENT_SET_STATEMENT(inflight_max, uint32_t)
+MQTT_CLIENT_SET_STATEMENT(inflight_timeout, uint32_t)
 MQTT_CLIENT_SET_STATEMENT(read_buf_size, uint32_t)
 MQTT_CLIENT_SET_STATEMENT(write_buf_size, uint32_t)
 MQTT_CLIENT_SET_STATEMENT(reconnect_try_duration, uint32_t)
 MQTT_CLIENT_SET_STATEMENT(reconnect_handler, reconnect_handler_t)
 MQTT_CLIENT_SET_STATEMENT(interceptor_handler, interceptor_handler_t)
+#ifdef MQTT_USING_REACTOR
+MQTT_CLIENT_SET_STATEMENT(reactor, mqtt_reactor_t*)
+#endif
+#ifdef MQTT_USING_STREAM_RECEIVE
+MQTT_CLIENT_SET_STATEMENT(stream_handler, stream_handler_t)
+#endif
 
 void mqtt_sleep_ms(int ms);
 mqtt_client_t *mqtt_lease(void);
@@ -324,9 +570,25 @@ int mqtt_connect(mqtt_client_t* c);
 int mqtt_disconnect(mqtt_client_t* c);
 int mqtt_keep_alive(mqtt_client_t* c);
 int mqtt_subscribe(mqtt_client_t* c, const char* topic_filter, mqtt_qos_t qos, message_handler_t msg_handler);
+int mqtt_subscribe_many(mqtt_client_t* c, const mqtt_subscription_t* subs, int count);
 int mqtt_unsubscribe(mqtt_client_t* c, const char* topic_filter);
 int mqtt_publish(mqtt_client_t* c, const char* topic_filter, mqtt_message_t* msg);
+mqtt_publish_template_t *mqtt_publish_template_create(const char* topic, mqtt_qos_t qos, uint8_t retained);
+void mqtt_publish_template_destroy(mqtt_publish_template_t* tpl);
+int mqtt_publish_by_template(mqtt_client_t* c, const mqtt_publish_template_t* tpl, mqtt_message_t* msg);
+#ifdef MQTT_USING_PUBLISH_ASYNC
+int mqtt_publish_async(mqtt_client_t* c, const char* topic_filter, mqtt_message_t* msg, publish_handler_t handler, void* arg);
+#endif
+#ifdef MQTT_USING_PUBLISH_STREAM
+int mqtt_publish_stream(mqtt_client_t* c, const char* topic_filter, mqtt_message_t* msg, mqtt_publish_source_t* source, publish_handler_t handler, void* arg);
+#endif
 int mqtt_list_subscribe_topic(mqtt_client_t* c);
+int mqtt_get_rtt(mqtt_client_t* c, uint32_t* srtt, uint32_t* rttvar, uint32_t* rto);
+int mqtt_get_state(mqtt_client_t* c, client_state_t* state, uint32_t* inflight);
+int mqtt_set_reconnect_policy(mqtt_client_t* c, const mqtt_reconnect_policy_t* policy);
+int mqtt_get_reconnect_stats(mqtt_client_t* c, mqtt_reconnect_stats_t* stats);
+int mqtt_add_endpoint(mqtt_client_t* c, char* host, char* port);
+int mqtt_get_endpoint(mqtt_client_t* c, int index, mqtt_endpoint_t* ep);
 int mqtt_set_will_options(mqtt_client_t* c, char *topic, mqtt_qos_t qos, uint8_t retained, char *message);
 
 #ifdef __cplusplus
@@ -14,14 +14,47 @@ int nettype_tcp_read(network_t *n, unsigned char *read_buf, int len, int timeout
     return platform_net_socket_recv_timeout(n->socket, read_buf, len, timeout);
 }
 
+int nettype_tcp_read_some(network_t *n, unsigned char *read_buf, int len, int timeout)
+{
+    return platform_net_socket_recv_some(n->socket, read_buf, len, timeout);
+}
+
 int nettype_tcp_write(network_t *n, unsigned char *write_buf, int len, int timeout)
 {
     return platform_net_socket_write_timeout(n->socket, write_buf, len, timeout);
 }
 
+int nettype_tcp_writev(network_t *n, mqtt_iovec_t *iov, int iovcnt, int timeout)
+{
+    return platform_net_socket_writev_timeout(n->socket, iov, iovcnt, timeout);
+}
+
+int nettype_tcp_sendfile(network_t *n, int in_fd, unsigned int offset, int len, int timeout)
+{
+#ifdef PLATFORM_NET_SOCKET_SENDFILE
+    return platform_net_socket_sendfile_timeout(n->socket, in_fd, offset, len, timeout);
+#else
+    RETURN_ERROR(MQTT_NOT_SUPPORT_ERROR);
+#endif
+}
+
+int nettype_tcp_sendfile_is_supported(network_t *n)
+{
+    (void) n;
+#ifdef PLATFORM_NET_SOCKET_SENDFILE
+    return 1;
+#else
+    return 0;
+#endif
+}
+
 int nettype_tcp_connect(network_t* n)
 {
+#ifdef PLATFORM_NET_SOCKET_CONNECT_TIMEOUT
+    n->socket = platform_net_socket_connect_timeout(n->host, n->port, PLATFORM_NET_PROTO_TCP, n->connect_timeout);
+#else
     n->socket = platform_net_socket_connect(n->host, n->port, PLATFORM_NET_PROTO_TCP);
+#endif
     if (n->socket < 0)
         RETURN_ERROR(n->socket);
     
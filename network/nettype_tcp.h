@@ -16,7 +16,11 @@ extern "C" {
 #endif
 
 int nettype_tcp_read(network_t *n, unsigned char *buf, int len, int timeout);
+int nettype_tcp_read_some(network_t *n, unsigned char *buf, int len, int timeout);
 int nettype_tcp_write(network_t *n, unsigned char *buf, int len, int timeout);
+int nettype_tcp_writev(network_t *n, mqtt_iovec_t *iov, int iovcnt, int timeout);
+int nettype_tcp_sendfile(network_t *n, int in_fd, unsigned int offset, int len, int timeout);
+int nettype_tcp_sendfile_is_supported(network_t *n);
 int nettype_tcp_connect(network_t* n);
 void nettype_tcp_disconnect(network_t* n);
 
@@ -141,8 +141,14 @@ int nettype_tls_connect(network_t* n)
     if (MQTT_SUCCESS_ERROR != rc)
         goto exit;
 
+#ifdef PLATFORM_NET_SOCKET_CONNECT_TIMEOUT
+    nettype_tls_params->socket_fd.fd = platform_net_socket_connect_timeout(n->host, n->port, PLATFORM_NET_PROTO_TCP, n->connect_timeout);
+    if ((rc = nettype_tls_params->socket_fd.fd) < 0)
+        goto exit;
+#else
     if (0 != (rc = mbedtls_net_connect(&(nettype_tls_params->socket_fd), n->host, n->port, MBEDTLS_NET_PROTO_TCP)))
         goto exit;
+#endif
 
     while ((rc = mbedtls_ssl_handshake(&(nettype_tls_params->ssl))) != 0) {
         if (rc != MBEDTLS_ERR_SSL_WANT_READ && rc != MBEDTLS_ERR_SSL_WANT_WRITE) {
@@ -161,6 +167,7 @@ int nettype_tls_connect(network_t* n)
         goto exit;
     }
 
+    n->socket = nettype_tls_params->socket_fd.fd;
     n->nettype_tls_params = nettype_tls_params;
     RETURN_ERROR(MQTT_SUCCESS_ERROR)
 
@@ -223,6 +230,28 @@ int nettype_tls_write(network_t *n, unsigned char *buf, int len, int timeout)
     return write_len;
 }
 
+/* mbedtls copies the plaintext into its own record buffer anyway, so the segments are simply written in turn */
+int nettype_tls_writev(network_t *n, mqtt_iovec_t *iov, int iovcnt, int timeout)
+{
+    int i, rc;
+    int write_len = 0;
+    platform_timer_t timer;
+
+    platform_timer_cutdown(&timer, timeout);
+
+    for (i = 0; i < iovcnt; i++) {
+        rc = nettype_tls_write(n, iov[i].buf, iov[i].len, platform_timer_remain(&timer));
+        if (rc < 0)
+            return (write_len > 0) ? write_len : rc;
+
+        write_len += rc;
+        if (rc < iov[i].len)
+            break;
+    }
+
+    return write_len;
+}
+
 int nettype_tls_read(network_t *n, unsigned char *buf, int len, int timeout)
 {
     int rc = 0;
@@ -250,4 +279,26 @@ int nettype_tls_read(network_t *n, unsigned char *buf, int len, int timeout)
     return read_len;
 }
 
+int nettype_tls_read_some(network_t *n, unsigned char *buf, int len, int timeout)
+{
+    int rc = 0;
+
+    if (NULL == n)
+        RETURN_ERROR(MQTT_NULL_VALUE_ERROR);
+    
+    nettype_tls_params_t *nettype_tls_params = (nettype_tls_params_t *) n->nettype_tls_params;
+
+    mbedtls_ssl_conf_read_timeout(&(nettype_tls_params->ssl_conf), (timeout > 0) ? timeout : 1);
+
+    rc = mbedtls_ssl_read(&(nettype_tls_params->ssl), buf, len);
+    if (rc > 0)
+        return rc;
+
+    if ((rc == MBEDTLS_ERR_SSL_WANT_WRITE) || (rc == MBEDTLS_ERR_SSL_WANT_READ) || (rc == MBEDTLS_ERR_SSL_TIMEOUT))
+        return 0;
+
+    /* the peer closed the connection or a fatal error occurred */
+    return -1;
+}
+
 #endif /* MQTT_NETWORK_TYPE_NO_TLS */
@@ -51,7 +51,9 @@ typedef struct nettype_tls_params {
 } nettype_tls_params_t;
 
 int nettype_tls_read(network_t *n, unsigned char *buf, int len, int timeout);
+int nettype_tls_read_some(network_t *n, unsigned char *buf, int len, int timeout);
 int nettype_tls_write(network_t *n, unsigned char *buf, int len, int timeout);
+int nettype_tls_writev(network_t *n, mqtt_iovec_t *iov, int iovcnt, int timeout);
 int nettype_tls_connect(network_t* n);
 void nettype_tls_disconnect(network_t* n);
 
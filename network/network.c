@@ -22,6 +22,15 @@ int network_read(network_t *n, unsigned char *buf, int len, int timeout)
     return nettype_tcp_read(n, buf, len, timeout);
 }
 
+int network_read_some(network_t *n, unsigned char *buf, int len, int timeout)
+{
+#ifndef MQTT_NETWORK_TYPE_NO_TLS
+    if (n->channel)
+        return nettype_tls_read_some(n, buf, len, timeout);
+#endif
+    return nettype_tcp_read_some(n, buf, len, timeout);
+}
+
 int network_write(network_t *n, unsigned char *buf, int len, int timeout)
 {
 #ifndef MQTT_NETWORK_TYPE_NO_TLS
@@ -31,6 +40,34 @@ int network_write(network_t *n, unsigned char *buf, int len, int timeout)
     return nettype_tcp_write(n, buf, len, timeout);
 }
 
+int network_writev(network_t *n, mqtt_iovec_t *iov, int iovcnt, int timeout)
+{
+#ifndef MQTT_NETWORK_TYPE_NO_TLS
+    if (n->channel)
+        return nettype_tls_writev(n, iov, iovcnt, timeout);
+#endif
+    return nettype_tcp_writev(n, iov, iovcnt, timeout);
+}
+
+/* 把文件 in_fd 中从 offset 开始的 len 字节直接写到连接上，只有明文 TCP 支持 */
+int network_sendfile(network_t *n, int in_fd, unsigned int offset, int len, int timeout)
+{
+#ifndef MQTT_NETWORK_TYPE_NO_TLS
+    if (n->channel)
+        RETURN_ERROR(MQTT_NOT_SUPPORT_ERROR);
+#endif
+    return nettype_tcp_sendfile(n, in_fd, offset, len, timeout);
+}
+
+int network_sendfile_is_supported(network_t *n)
+{
+#ifndef MQTT_NETWORK_TYPE_NO_TLS
+    if (n->channel)
+        return 0;
+#endif
+    return nettype_tcp_sendfile_is_supported(n);
+}
+
 int network_connect(network_t *n)
 {
 #ifndef MQTT_NETWORK_TYPE_NO_TLS
@@ -59,6 +96,7 @@ int network_init(network_t *n, const char *host, const char *port, const char *c
     n->socket = -1;
     n->host = host;
     n->port = port;
+    n->connect_timeout = 0;
 
 #ifndef MQTT_NETWORK_TYPE_NO_TLS
     n->channel = 0;
@@ -76,6 +114,7 @@ void network_release(network_t* n)
     {
         network_disconnect(n);
         memset(n, 0, sizeof(network_t));
+        n->socket = -1;     /* 防止重复释放时关闭 0 号描述符 */
     }
 }
 
@@ -100,6 +139,12 @@ int network_set_ca(network_t *n, const char *ca)
     RETURN_ERROR(MQTT_SUCCESS_ERROR);
 }
 
+void network_set_connect_timeout(network_t* n, unsigned int timeout)
+{
+    if (NULL != n)
+        n->connect_timeout = timeout;
+}
+
 int network_set_host_port(network_t* n, char *host, char *port)
 {
     if (!(n && host && port))
@@ -9,6 +9,7 @@
 #define _NETWORK_H_
 
 #include "mqtt_defconfig.h"
+#include "mqtt_iovec.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -21,6 +22,7 @@ typedef struct network {
     const char                  *host;
     const char                  *port;
     int                         socket;
+    unsigned int                connect_timeout;        // connect timeout in millisecond, 0: no limit
 #ifndef MQTT_NETWORK_TYPE_NO_TLS
     int                         channel;        /* tcp or tls */
     const char                  *ca_crt;
@@ -34,8 +36,13 @@ int network_init(network_t *n, const char *host, const char *port, const char *c
 int network_set_ca(network_t *n, const char *ca);
 void network_set_channel(network_t *n, int channel);
 int network_set_host_port(network_t* n, char *host, char *port);
+void network_set_connect_timeout(network_t* n, unsigned int timeout);
 int network_read(network_t* n, unsigned char* buf, int len, int timeout);
+int network_read_some(network_t* n, unsigned char* buf, int len, int timeout);
 int network_write(network_t* n, unsigned char* buf, int len, int timeout);
+int network_writev(network_t* n, mqtt_iovec_t* iov, int iovcnt, int timeout);
+int network_sendfile(network_t* n, int in_fd, unsigned int offset, int len, int timeout);
+int network_sendfile_is_supported(network_t* n);
 int network_connect(network_t* n);
 void network_disconnect(network_t *n);
 void network_release(network_t* n);
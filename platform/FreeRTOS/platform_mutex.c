@@ -33,3 +33,25 @@ int platform_mutex_destroy(platform_mutex_t* m)
     vSemaphoreDelete(m->mutex);
     return 0;
 }
+
+int platform_sem_init(platform_sem_t* s)
+{
+    s->sem = xSemaphoreCreateCounting(0xffff, 0);
+    return 0;
+}
+
+int platform_sem_wait(platform_sem_t* s, unsigned int timeout)
+{
+    return (pdTRUE == xSemaphoreTake(s->sem, pdMS_TO_TICKS(timeout))) ? 0 : -1;
+}
+
+int platform_sem_post(platform_sem_t* s)
+{
+    return xSemaphoreGive(s->sem);
+}
+
+int platform_sem_destroy(platform_sem_t* s)
+{
+    vSemaphoreDelete(s->sem);
+    return 0;
+}
@@ -32,3 +32,24 @@ int platform_mutex_destroy(platform_mutex_t* m)
 {
     return rt_mutex_delete((m->mutex));
 }
+
+int platform_sem_init(platform_sem_t* s)
+{
+    s->sem = rt_sem_create("platform_sem", 0, RT_IPC_FLAG_FIFO);
+    return 0;
+}
+
+int platform_sem_wait(platform_sem_t* s, unsigned int timeout)
+{
+    return rt_sem_take((s->sem), rt_tick_from_millisecond(timeout));
+}
+
+int platform_sem_post(platform_sem_t* s)
+{
+    return rt_sem_release((s->sem));
+}
+
+int platform_sem_destroy(platform_sem_t* s)
+{
+    return rt_sem_delete((s->sem));
+}
@@ -80,6 +80,32 @@ int platform_net_socket_recv_timeout(int fd, unsigned char *buf, int len, int ti
     return len - nleft;
 }
 
+int platform_net_socket_recv_some(int fd, unsigned char *buf, int len, int timeout)
+{
+    int nread;
+    struct timeval tv = {
+        timeout / 1000, 
+        (timeout % 1000) * 1000
+    };
+    
+    if (tv.tv_sec < 0 || (tv.tv_sec == 0 && tv.tv_usec <= 0)) {
+        tv.tv_sec = 0;
+        tv.tv_usec = 100;
+    }
+
+    platform_net_socket_setsockopt(fd, SOL_SOCKET, SO_RCVTIMEO, (char *)&tv, sizeof(struct timeval));
+
+    nread = platform_net_socket_recv(fd, buf, len, 0);
+    if (nread > 0)
+        return nread;
+
+    /* recv() returns 0 when the peer has closed the connection */
+    if (nread == 0)
+        return -1;
+
+    return ((errno == EAGAIN) || (errno == EWOULDBLOCK) || (errno == EINTR)) ? 0 : -1;
+}
+
 int platform_net_socket_write(int fd, void *buf, size_t len)
 {
     return send(fd, buf, len, 0);
@@ -102,6 +128,24 @@ int platform_net_socket_write_timeout(int fd, unsigned char *buf, int len, int t
 	return send(fd, buf, len, 0);
 }
 
+int platform_net_socket_writev_timeout(int fd, mqtt_iovec_t *iov, int iovcnt, int timeout)
+{
+    int i, rc;
+    int nwrite = 0;
+
+    for (i = 0; i < iovcnt; i++) {
+        rc = platform_net_socket_write_timeout(fd, iov[i].buf, iov[i].len, timeout);
+        if (rc < 0)
+            return (nwrite > 0) ? nwrite : rc;
+
+        nwrite += rc;
+        if (rc < iov[i].len)
+            break;
+    }
+
+    return nwrite;
+}
+
 int platform_net_socket_close(int fd)
 {
     return closesocket(fd);
@@ -36,8 +36,10 @@
 int platform_net_socket_connect(const char *host, const char *port, int proto);
 int platform_net_socket_recv(int fd, void *buf, size_t len, int flags);
 int platform_net_socket_recv_timeout(int fd, unsigned char *buf, int len, int timeout);
+int platform_net_socket_recv_some(int fd, unsigned char *buf, int len, int timeout);
 int platform_net_socket_write(int fd, void *buf, size_t len);
 int platform_net_socket_write_timeout(int fd, unsigned char *buf, int len, int timeout);
+int platform_net_socket_writev_timeout(int fd, mqtt_iovec_t *iov, int iovcnt, int timeout);
 int platform_net_socket_close(int fd);
 int platform_net_socket_set_block(int fd);
 int platform_net_socket_set_nonblock(int fd);
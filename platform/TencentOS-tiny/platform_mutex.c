@@ -31,3 +31,23 @@ int platform_mutex_destroy(platform_mutex_t* m)
 {
     return tos_mutex_destroy(&(m->mutex));
 }
+
+int platform_sem_init(platform_sem_t* s)
+{
+    return tos_sem_create(&(s->sem), 0);
+}
+
+int platform_sem_wait(platform_sem_t* s, unsigned int timeout)
+{
+    return tos_sem_pend(&(s->sem), tos_millisec2tick(timeout));
+}
+
+int platform_sem_post(platform_sem_t* s)
+{
+    return tos_sem_post(&(s->sem));
+}
+
+int platform_sem_destroy(platform_sem_t* s)
+{
+    return tos_sem_destroy(&(s->sem));
+}
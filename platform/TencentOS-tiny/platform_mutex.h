@@ -14,10 +14,19 @@ typedef struct platform_mutex {
     k_mutex_t mutex;
 } platform_mutex_t;
 
+typedef struct platform_sem {
+    k_sem_t sem;
+} platform_sem_t;
+
 int platform_mutex_init(platform_mutex_t* m);
 int platform_mutex_lock(platform_mutex_t* m);
 int platform_mutex_trylock(platform_mutex_t* m);
 int platform_mutex_unlock(platform_mutex_t* m);
 int platform_mutex_destroy(platform_mutex_t* m);
 
+int platform_sem_init(platform_sem_t* s);
+int platform_sem_wait(platform_sem_t* s, unsigned int timeout);
+int platform_sem_post(platform_sem_t* s);
+int platform_sem_destroy(platform_sem_t* s);
+
 #endif
@@ -0,0 +1,103 @@
+/*
+ * @Author: jiejie
+ * @Github: https://github.com/jiejieTop
+ * @Date: 2026-10-16 10:12:31
+ * @LastEditTime: 2026-10-16 10:12:31
+ * @Description: the code belongs to jiejie, please keep the author information and source code according to the license.
+ */
+#include "platform_event.h"
+#include "mqtt_error.h"
+
+int platform_event_init(platform_event_t* e)
+{
+    struct epoll_event ev = {0};
+
+    e->epfd = epoll_create1(EPOLL_CLOEXEC);
+    if (e->epfd < 0)
+        RETURN_ERROR(MQTT_FAILED_ERROR);
+
+    e->wakeup_fd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+    if (e->wakeup_fd < 0) {
+        close(e->epfd);
+        RETURN_ERROR(MQTT_FAILED_ERROR);
+    }
+
+    /* the wakeup fd is registered with a NULL cookie, it is never reported to the caller */
+    ev.events = EPOLLIN;
+    ev.data.ptr = NULL;
+    if (epoll_ctl(e->epfd, EPOLL_CTL_ADD, e->wakeup_fd, &ev) < 0) {
+        platform_event_destroy(e);
+        RETURN_ERROR(MQTT_FAILED_ERROR);
+    }
+
+    RETURN_ERROR(MQTT_SUCCESS_ERROR);
+}
+
+int platform_event_add(platform_event_t* e, int fd, void *data)
+{
+    struct epoll_event ev = {0};
+
+    ev.events = EPOLLIN | EPOLLRDHUP;
+    ev.data.ptr = data;
+
+    if (epoll_ctl(e->epfd, EPOLL_CTL_ADD, fd, &ev) == 0)
+        RETURN_ERROR(MQTT_SUCCESS_ERROR);
+
+    /* the fd number was reused by a new socket, just update the cookie */
+    if ((EEXIST == errno) && (epoll_ctl(e->epfd, EPOLL_CTL_MOD, fd, &ev) == 0))
+        RETURN_ERROR(MQTT_SUCCESS_ERROR);
+
+    RETURN_ERROR(MQTT_FAILED_ERROR);
+}
+
+int platform_event_del(platform_event_t* e, int fd)
+{
+    struct epoll_event ev = {0};
+
+    if (epoll_ctl(e->epfd, EPOLL_CTL_DEL, fd, &ev) < 0)
+        RETURN_ERROR(MQTT_FAILED_ERROR);
+
+    RETURN_ERROR(MQTT_SUCCESS_ERROR);
+}
+
+int platform_event_wait(platform_event_t* e, void **data, int max, int timeout)
+{
+    int i, n, count = 0;
+    uint64_t value;
+    struct epoll_event events[max];
+
+    n = epoll_wait(e->epfd, events, max, timeout);
+    if (n < 0)
+        return (EINTR == errno) ? 0 : MQTT_FAILED_ERROR;
+
+    for (i = 0; i < n; i++) {
+        if (NULL == events[i].data.ptr) {
+            /* drain the wakeup counter */
+            while (read(e->wakeup_fd, &value, sizeof(value)) > 0);
+            continue;
+        }
+        data[count++] = events[i].data.ptr;
+    }
+
+    return count;
+}
+
+void platform_event_wakeup(platform_event_t* e)
+{
+    uint64_t value = 1;
+
+    if (write(e->wakeup_fd, &value, sizeof(value)) < 0)
+        (void) value;
+}
+
+void platform_event_destroy(platform_event_t* e)
+{
+    if (e->wakeup_fd >= 0)
+        close(e->wakeup_fd);
+
+    if (e->epfd >= 0)
+        close(e->epfd);
+
+    e->wakeup_fd = -1;
+    e->epfd = -1;
+}
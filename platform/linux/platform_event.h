@@ -0,0 +1,37 @@
+/*
+ * @Author: jiejie
+ * @Github: https://github.com/jiejieTop
+ * @Date: 2026-10-16 10:12:31
+ * @LastEditTime: 2026-10-16 10:12:31
+ * @Description: the code belongs to jiejie, please keep the author information and source code according to the license.
+ */
+#ifndef _PLATFORM_EVENT_H_
+#define _PLATFORM_EVENT_H_
+
+#include <stdint.h>
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <unistd.h>
+#include <errno.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct platform_event {
+    int epfd;
+    int wakeup_fd;
+} platform_event_t;
+
+int platform_event_init(platform_event_t* e);
+int platform_event_add(platform_event_t* e, int fd, void *data);
+int platform_event_del(platform_event_t* e, int fd);
+int platform_event_wait(platform_event_t* e, void **data, int max, int timeout);
+void platform_event_wakeup(platform_event_t* e);
+void platform_event_destroy(platform_event_t* e);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
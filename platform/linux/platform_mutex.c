@@ -5,6 +5,8 @@
  * @LastEditTime: 2020-02-23 15:01:06
  * @Description: the code belongs to jiejie, please keep the author information and source code according to the license.
  */
+#include <time.h>
+#include <errno.h>
 #include "platform_mutex.h"
 
 int platform_mutex_init(platform_mutex_t* m)
@@ -31,3 +33,60 @@ int platform_mutex_destroy(platform_mutex_t* m)
 {
     return pthread_mutex_destroy(&(m->mutex));
 }
+
+int platform_sem_init(platform_sem_t* s)
+{
+    pthread_condattr_t attr;
+
+    s->count = 0;
+    pthread_mutex_init(&(s->mutex), NULL);
+
+    /* use the monotonic clock like platform_timer, a wall clock change does not stretch the wait */
+    pthread_condattr_init(&attr);
+    pthread_condattr_setclock(&attr, CLOCK_MONOTONIC);
+    pthread_cond_init(&(s->cond), &attr);
+    pthread_condattr_destroy(&attr);
+
+    return 0;
+}
+
+int platform_sem_wait(platform_sem_t* s, unsigned int timeout)
+{
+    int rc = 0;
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    ts.tv_sec += timeout / 1000;
+    ts.tv_nsec += (timeout % 1000) * 1000000;
+    if (ts.tv_nsec >= 1000000000) {
+        ts.tv_sec++;
+        ts.tv_nsec -= 1000000000;
+    }
+
+    pthread_mutex_lock(&(s->mutex));
+    while ((0 == s->count) && (ETIMEDOUT != rc))
+        rc = pthread_cond_timedwait(&(s->cond), &(s->mutex), &ts);
+    if (0 != s->count) {
+        s->count--;
+        rc = 0;
+    }
+    pthread_mutex_unlock(&(s->mutex));
+
+    return rc;
+}
+
+int platform_sem_post(platform_sem_t* s)
+{
+    pthread_mutex_lock(&(s->mutex));
+    s->count++;
+    pthread_cond_signal(&(s->cond));
+    pthread_mutex_unlock(&(s->mutex));
+
+    return 0;
+}
+
+int platform_sem_destroy(platform_sem_t* s)
+{
+    pthread_cond_destroy(&(s->cond));
+    return pthread_mutex_destroy(&(s->mutex));
+}
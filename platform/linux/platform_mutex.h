@@ -17,12 +17,24 @@ typedef struct platform_mutex {
     pthread_mutex_t mutex;
 } platform_mutex_t;
 
+/* counting semaphore, platform_sem_wait() returns 0 when it took a count before the timeout (ms) */
+typedef struct platform_sem {
+    pthread_mutex_t mutex;
+    pthread_cond_t cond;
+    unsigned int count;
+} platform_sem_t;
+
 int platform_mutex_init(platform_mutex_t* m);
 int platform_mutex_lock(platform_mutex_t* m);
 int platform_mutex_trylock(platform_mutex_t* m);
 int platform_mutex_unlock(platform_mutex_t* m);
 int platform_mutex_destroy(platform_mutex_t* m);
 
+int platform_sem_init(platform_sem_t* s);
+int platform_sem_wait(platform_sem_t* s, unsigned int timeout);
+int platform_sem_post(platform_sem_t* s);
+int platform_sem_destroy(platform_sem_t* s);
+
 #ifdef __cplusplus
 }
 #endif
@@ -5,13 +5,34 @@
  * @LastEditTime: 2020-06-05 17:13:00
  * @Description: the code belongs to jiejie, please keep the author information and source code according to the license.
  */
+#include <pthread.h>
 #include "platform_net_socket.h"
+#include "platform_timer.h"
+#include "platform_thread.h"
+#include "platform_memory.h"
 #include "mqtt_error.h"
 
-int platform_net_socket_connect(const char *host, const char *port, int proto)
+/* one resolved address, copied out of the addrinfo list so that it can be cached */
+typedef struct platform_net_addr {
+    struct sockaddr_storage     addr;
+    socklen_t                   len;
+    int                         family;
+    int                         socktype;
+    int                         protocol;
+} platform_net_addr_t;
+
+/*
+ * Resolve host:port and order the addresses for Happy Eyeballs (RFC 8305): keep the
+ * resolver's preferred address first, then alternate between the address families.
+ * Returns the number of addresses.
+ */
+static int platform_net_socket_resolve(const char *host, const char *port, int proto, platform_net_addr_t *out)
 {
-    int fd, ret = MQTT_SOCKET_UNKNOWN_HOST_ERROR;
+    int n = 0, i = 0, j = 0, np = 0, no = 0;
     struct addrinfo hints, *addr_list, *cur;
+    struct addrinfo *sorted[PLATFORM_NET_CONNECT_ATTEMPT_MAX];
+    struct addrinfo *primary[PLATFORM_NET_CONNECT_ATTEMPT_MAX];
+    struct addrinfo *other[PLATFORM_NET_CONNECT_ATTEMPT_MAX];
     
     /* Do name resolution with both IPv6 and IPv4 */
     memset(&hints, 0, sizeof(hints));
@@ -19,28 +40,444 @@ int platform_net_socket_connect(const char *host, const char *port, int proto)
     hints.ai_socktype = (proto == PLATFORM_NET_PROTO_UDP) ? SOCK_DGRAM : SOCK_STREAM;
     hints.ai_protocol = (proto == PLATFORM_NET_PROTO_UDP) ? IPPROTO_UDP : IPPROTO_TCP;
     
-    if (getaddrinfo(host, port, &hints, &addr_list) != 0) {
-        return ret;
-    }
-    
+    if (getaddrinfo(host, port, &hints, &addr_list) != 0)
+        return 0;
+
     for (cur = addr_list; cur != NULL; cur = cur->ai_next) {
-        fd = socket(cur->ai_family, cur->ai_socktype, cur->ai_protocol);
-        if (fd < 0) {
-            ret = MQTT_SOCKET_FAILED_ERROR;
+        if (cur->ai_addrlen > sizeof(out->addr))
             continue;
+        if (cur->ai_family == addr_list->ai_family) {
+            if (np < PLATFORM_NET_CONNECT_ATTEMPT_MAX)
+                primary[np++] = cur;
+        } else if (no < PLATFORM_NET_CONNECT_ATTEMPT_MAX) {
+            other[no++] = cur;
         }
+    }
 
-        if (connect(fd, cur->ai_addr, cur->ai_addrlen) == 0) {
-            ret = fd;
-            break;
+    while ((n < PLATFORM_NET_CONNECT_ATTEMPT_MAX) && ((i < np) || (j < no))) {
+        if (i < np)
+            sorted[n++] = primary[i++];
+        if ((n < PLATFORM_NET_CONNECT_ATTEMPT_MAX) && (j < no))
+            sorted[n++] = other[j++];
+    }
+
+    for (i = 0; i < n; i++) {
+        memcpy(&out[i].addr, sorted[i]->ai_addr, sorted[i]->ai_addrlen);
+        out[i].len = sorted[i]->ai_addrlen;
+        out[i].family = sorted[i]->ai_family;
+        out[i].socktype = sorted[i]->ai_socktype;
+        out[i].protocol = sorted[i]->ai_protocol;
+    }
+
+    freeaddrinfo(addr_list);
+    return n;
+}
+
+#if PLATFORM_NET_DNS_CACHE_TTL > 0
+/* resolved addresses of one host:port, reused until the TTL expires */
+typedef struct platform_net_dns_entry {
+    char                        host[PLATFORM_NET_DNS_HOST_MAX];
+    char                        port[8];
+    int                         proto;
+    int                         count;          /* 0: the entry is free */
+    int                         refreshing;     /* a background refresh is running */
+    unsigned long               expire;         /* platform_timer_now() after which the entry is stale */
+    unsigned long               used;           /* last lookup, the least recently used entry is replaced */
+    platform_net_addr_t         addrs[PLATFORM_NET_CONNECT_ATTEMPT_MAX];    /* the last connected address first */
+} platform_net_dns_entry_t;
+
+typedef struct platform_net_dns_key {
+    char                        host[PLATFORM_NET_DNS_HOST_MAX];
+    char                        port[8];
+    int                         proto;
+} platform_net_dns_key_t;
+
+/* argument of the background refresh, owned and freed by the refresh thread */
+typedef struct platform_net_dns_refresh_arg {
+    platform_net_dns_key_t      key;
+    int                         slot;           /* cache entry whose refreshing flag the thread clears */
+} platform_net_dns_refresh_arg_t;
+
+static pthread_mutex_t platform_net_dns_lock = PTHREAD_MUTEX_INITIALIZER;
+static platform_net_dns_entry_t platform_net_dns_cache[PLATFORM_NET_DNS_CACHE_SIZE];
+
+static int platform_net_dns_key_init(platform_net_dns_key_t *key, const char *host, const char *port, int proto)
+{
+    if ((strlen(host) >= sizeof(key->host)) || (strlen(port) >= sizeof(key->port)))
+        return -1;      /* too long to be cached */
+
+    strcpy(key->host, host);
+    strcpy(key->port, port);
+    key->proto = proto;
+    return 0;
+}
+
+/* must be called with platform_net_dns_lock held */
+static platform_net_dns_entry_t *platform_net_dns_find(const platform_net_dns_key_t *key)
+{
+    int i;
+    platform_net_dns_entry_t *e;
+
+    for (i = 0; i < PLATFORM_NET_DNS_CACHE_SIZE; i++) {
+        e = &platform_net_dns_cache[i];
+        if ((e->count > 0) && (e->proto == key->proto) && (strcmp(e->port, key->port) == 0) && (strcmp(e->host, key->host) == 0))
+            return e;
+    }
+    return NULL;
+}
+
+/* replace the cached addresses, keeping the last connected one in front; lock held */
+static void platform_net_dns_store(const platform_net_dns_key_t *key, const platform_net_addr_t *addrs, int n)
+{
+    int i, last = -1;
+    platform_net_dns_entry_t *e, *victim;
+
+    if (NULL == (e = platform_net_dns_find(key))) {
+        victim = &platform_net_dns_cache[0];
+        for (i = 0; i < PLATFORM_NET_DNS_CACHE_SIZE; i++) {
+            e = &platform_net_dns_cache[i];
+            if ((0 == e->count) && (0 == e->refreshing)) {
+                victim = e;
+                break;
+            }
+            if (e->used < victim->used)
+                victim = e;
+        }
+        e = victim;
+        memset(e, 0, sizeof(*e));
+        strcpy(e->host, key->host);
+        strcpy(e->port, key->port);
+        e->proto = key->proto;
+    } else {
+        for (i = 0; i < n; i++) {
+            if ((addrs[i].len == e->addrs[0].len) && (memcmp(&addrs[i].addr, &e->addrs[0].addr, addrs[i].len) == 0)) {
+                last = i;
+                break;
+            }
+        }
+    }
+
+    e->count = 0;
+    if (last >= 0)
+        e->addrs[e->count++] = addrs[last];
+    for (i = 0; i < n; i++) {
+        if (i != last)
+            e->addrs[e->count++] = addrs[i];
+    }
+    e->expire = platform_timer_now() + PLATFORM_NET_DNS_CACHE_TTL;
+    e->used = platform_timer_now();
+}
+
+static void platform_net_dns_refresh(void *param)
+{
+    int n;
+    platform_net_dns_refresh_arg_t *arg = (platform_net_dns_refresh_arg_t *)param;
+    platform_net_addr_t addrs[PLATFORM_NET_CONNECT_ATTEMPT_MAX];
+
+    n = platform_net_socket_resolve(arg->key.host, arg->key.port, arg->key.proto, addrs);
+
+    pthread_mutex_lock(&platform_net_dns_lock);
+    /* cleared by slot, the entry may have been dropped meanwhile and can no longer be found by key */
+    platform_net_dns_cache[arg->slot].refreshing = 0;
+    /* on failure keep serving the stale addresses, the next lookup tries again */
+    if (n > 0)
+        platform_net_dns_store(&arg->key, addrs, n);
+    pthread_mutex_unlock(&platform_net_dns_lock);
+
+    platform_memory_free(arg);
+}
+
+/* copy the cached addresses; a stale entry is still used while it is refreshed in the background */
+static int platform_net_dns_lookup(const platform_net_dns_key_t *key, platform_net_addr_t *out)
+{
+    int n = 0;
+    platform_thread_t *thread;
+    platform_net_dns_refresh_arg_t *arg;
+    platform_net_dns_entry_t *e;
+
+    pthread_mutex_lock(&platform_net_dns_lock);
+
+    if (NULL != (e = platform_net_dns_find(key))) {
+        n = e->count;
+        memcpy(out, e->addrs, n * sizeof(*out));
+        e->used = platform_timer_now();
+
+        if (((long)(e->used - e->expire) >= 0) && (0 == e->refreshing) && (NULL != (arg = platform_memory_alloc(sizeof(*arg))))) {
+            arg->key = *key;
+            arg->slot = (int)(e - platform_net_dns_cache);
+            thread = platform_thread_init("platform_net_dns_refresh", platform_net_dns_refresh, arg, 0, 0, 0);
+            if (NULL != thread) {
+                e->refreshing = 1;
+                /* the refresh thread runs on its own, only its handle is released here */
+                platform_thread_destroy(thread);
+                platform_memory_free(thread);
+            } else {
+                platform_memory_free(arg);
+            }
+        }
+    }
+
+    pthread_mutex_unlock(&platform_net_dns_lock);
+    return n;
+}
+
+/* remember which address connected, it is tried first next time */
+static void platform_net_dns_confirm(const platform_net_dns_key_t *key, const platform_net_addr_t *addr)
+{
+    int i;
+    platform_net_addr_t tmp;
+    platform_net_dns_entry_t *e;
+
+    pthread_mutex_lock(&platform_net_dns_lock);
+    if (NULL != (e = platform_net_dns_find(key))) {
+        for (i = 0; i < e->count; i++) {
+            if ((e->addrs[i].len == addr->len) && (memcmp(&e->addrs[i].addr, &addr->addr, addr->len) == 0)) {
+                tmp = e->addrs[i];
+                memmove(&e->addrs[1], &e->addrs[0], i * sizeof(tmp));
+                e->addrs[0] = tmp;
+                break;
+            }
         }
+    }
+    pthread_mutex_unlock(&platform_net_dns_lock);
+}
+
+/* forget a host whose cached addresses could not be connected */
+static void platform_net_dns_drop(const platform_net_dns_key_t *key)
+{
+    platform_net_dns_entry_t *e;
 
+    pthread_mutex_lock(&platform_net_dns_lock);
+    if (NULL != (e = platform_net_dns_find(key)))
+        e->count = 0;
+    pthread_mutex_unlock(&platform_net_dns_lock);
+}
+#endif /* PLATFORM_NET_DNS_CACHE_TTL > 0 */
+
+/*
+ * Start a non-blocking connection attempt.
+ * Returns the socket (with *done set when it connected at once) or -1 on failure.
+ */
+static int platform_net_socket_start(const platform_net_addr_t *addr, int *done)
+{
+    int fd;
+
+    *done = 0;
+
+    fd = socket(addr->family, addr->socktype, addr->protocol);
+    if (fd < 0)
+        return -1;
+
+    if (platform_net_socket_set_nonblock(fd) < 0) {
         close(fd);
-        ret = MQTT_CONNECT_FAILED_ERROR;
+        return -1;
     }
 
-    freeaddrinfo(addr_list);
-    return ret;
+    if (connect(fd, (const struct sockaddr *)&addr->addr, addr->len) == 0)
+        *done = 1;
+    else if (errno != EINPROGRESS) {
+        close(fd);
+        return -1;
+    }
+
+    return fd;
+}
+
+/*
+ * Race TCP connection attempts across the addresses: the next one starts when the
+ * previous attempt fails or has been pending for PLATFORM_NET_CONNECT_ATTEMPT_DELAY,
+ * the first established connection wins and the others are closed.
+ * deadline is NULL for no limit. *winner is set to the index of the connected address.
+ */
+static int platform_net_socket_race(const platform_net_addr_t *addrs, int n, platform_timer_t *deadline, int *winner)
+{
+    int i, rc, err, wait, done;
+    int started = 0, pending = 0, fd = -1;
+    int ret = MQTT_SOCKET_FAILED_ERROR;
+    socklen_t len;
+    struct pollfd pfds[PLATFORM_NET_CONNECT_ATTEMPT_MAX];
+    platform_timer_t stagger;
+
+    platform_timer_init(&stagger);
+
+    while (fd < 0) {
+        /* start the next attempt when none is pending or the current one is taking too long */
+        if ((started < n) && ((0 == pending) || platform_timer_is_expired(&stagger))) {
+            pfds[started].fd = platform_net_socket_start(&addrs[started], &done);
+            pfds[started].events = POLLOUT;
+            pfds[started].revents = 0;
+
+            if (pfds[started].fd >= 0) {
+                ret = MQTT_CONNECT_FAILED_ERROR;
+                if (done) {
+                    fd = pfds[started].fd;
+                    pfds[started].fd = -1;
+                    *winner = started++;
+                    break;
+                }
+                pending++;
+                platform_timer_cutdown(&stagger, PLATFORM_NET_CONNECT_ATTEMPT_DELAY);
+            }
+            started++;
+            continue;
+        }
+
+        if (0 == pending)
+            break;
+
+        if ((NULL != deadline) && platform_timer_is_expired(deadline)) {
+            ret = MQTT_CONNECT_FAILED_ERROR;
+            break;
+        }
+
+        wait = (started < n) ? platform_timer_remain(&stagger) : -1;
+        if ((NULL != deadline) && ((wait < 0) || (platform_timer_remain(deadline) < wait)))
+            wait = platform_timer_remain(deadline);
+
+        rc = poll(pfds, started, wait);
+        if (rc < 0) {
+            if (errno == EINTR)
+                continue;
+            break;
+        }
+
+        for (i = 0; (i < started) && (rc > 0); i++) {
+            if ((pfds[i].fd < 0) || (0 == pfds[i].revents))
+                continue;
+            rc--;
+
+            err = 0;
+            len = sizeof(err);
+            if ((getsockopt(pfds[i].fd, SOL_SOCKET, SO_ERROR, &err, &len) == 0) && (0 == err) &&
+                !(pfds[i].revents & (POLLERR | POLLHUP | POLLNVAL))) {
+                fd = pfds[i].fd;
+                pfds[i].fd = -1;
+                *winner = i;
+                break;
+            }
+
+            /* this attempt failed, start the next one without waiting for the delay */
+            close(pfds[i].fd);
+            pfds[i].fd = -1;
+            pending--;
+            platform_timer_init(&stagger);
+        }
+    }
+
+    for (i = 0; i < started; i++) {
+        if (pfds[i].fd >= 0)
+            close(pfds[i].fd);
+    }
+
+    if (fd < 0)
+        return ret;
+
+    /* the rest of the socket layer expects a blocking socket */
+    platform_net_socket_set_block(fd);
+    return fd;
+}
+
+/*
+ * Connect to host:port within timeout milliseconds (0: no limit).
+ * With PLATFORM_NET_DNS_CACHE_TTL > 0 the resolved addresses are cached per host:port,
+ * so a reconnect does not wait for the resolver, and the address that connected last
+ * time is tried first. If none of the cached addresses connects, the host is resolved
+ * again and the fresh addresses are tried within the remaining time.
+ */
+int platform_net_socket_connect_timeout(const char *host, const char *port, int proto, int timeout)
+{
+    int i, n = 0, fd, winner = 0;
+    platform_net_addr_t addrs[PLATFORM_NET_CONNECT_ATTEMPT_MAX];
+    platform_timer_t deadline;
+#if PLATFORM_NET_DNS_CACHE_TTL > 0
+    int cached = 0;
+    platform_net_dns_key_t key;
+    int keyed = (platform_net_dns_key_init(&key, host, port, proto) == 0);
+
+    if (keyed && ((n = platform_net_dns_lookup(&key, addrs)) > 0))
+        cached = 1;
+#endif
+
+    platform_timer_init(&deadline);
+    platform_timer_cutdown(&deadline, (timeout > 0) ? timeout : 0);
+
+    if (0 == n) {
+        if (0 == (n = platform_net_socket_resolve(host, port, proto, addrs)))
+            return MQTT_SOCKET_UNKNOWN_HOST_ERROR;
+#if PLATFORM_NET_DNS_CACHE_TTL > 0
+        if (keyed) {
+            pthread_mutex_lock(&platform_net_dns_lock);
+            platform_net_dns_store(&key, addrs, n);
+            pthread_mutex_unlock(&platform_net_dns_lock);
+        }
+#endif
+    }
+
+    /* connect() on a datagram socket does not block, the first usable address is enough */
+    if (proto == PLATFORM_NET_PROTO_UDP) {
+        fd = MQTT_SOCKET_FAILED_ERROR;
+        for (i = 0; i < n; i++) {
+            fd = socket(addrs[i].family, addrs[i].socktype, addrs[i].protocol);
+            if (fd < 0) {
+                fd = MQTT_SOCKET_FAILED_ERROR;
+                continue;
+            }
+
+            if (connect(fd, (const struct sockaddr *)&addrs[i].addr, addrs[i].len) == 0)
+                return fd;
+
+            close(fd);
+            fd = MQTT_CONNECT_FAILED_ERROR;
+        }
+        return fd;
+    }
+
+    fd = platform_net_socket_race(addrs, n, (timeout > 0) ? &deadline : NULL, &winner);
+
+#if PLATFORM_NET_DNS_CACHE_TTL > 0
+    if (fd >= 0) {
+        if (keyed)
+            platform_net_dns_confirm(&key, &addrs[winner]);
+    } else if (cached) {
+        /* the cached addresses may be out of date, resolve again */
+        platform_net_dns_drop(&key);
+        if ((timeout <= 0) || !platform_timer_is_expired(&deadline))
+            fd = platform_net_socket_connect_timeout(host, port, proto, (timeout > 0) ? platform_timer_remain(&deadline) : 0);
+    }
+#endif
+
+    return fd;
+}
+
+int platform_net_socket_connect(const char *host, const char *port, int proto)
+{
+    return platform_net_socket_connect_timeout(host, port, proto, 0);
+}
+
+/*
+ * Wait until the socket becomes readable/writable or the deadline expires.
+ * Returns >0 when ready, 0 on timeout and -1 on error.
+ */
+static int platform_net_socket_wait(int fd, short events, platform_timer_t *timer)
+{
+    int rc;
+    struct pollfd pfd;
+
+    if (platform_timer_is_expired(timer))
+        return 0;
+
+    pfd.fd = fd;
+    pfd.events = events;
+
+    do {
+        pfd.revents = 0;
+        rc = poll(&pfd, 1, platform_timer_remain(timer));
+    } while ((rc < 0) && (errno == EINTR));
+
+    if ((rc > 0) && (pfd.revents & (POLLERR | POLLNVAL)))
+        return -1;
+
+    return rc;
 }
 
 int platform_net_socket_recv(int fd, void *buf, size_t len, int flags)
@@ -50,37 +487,71 @@ int platform_net_socket_recv(int fd, void *buf, size_t len, int flags)
 
 int platform_net_socket_recv_timeout(int fd, unsigned char *buf, int len, int timeout)
 {
+    int rc;
     int nread;
     int nleft = len;
     unsigned char *ptr; 
+    platform_timer_t timer;
     ptr = buf;
 
-    struct timeval tv = {
-        timeout / 1000, 
-        (timeout % 1000) * 1000
-    };
-    
-    if (tv.tv_sec < 0 || (tv.tv_sec == 0 && tv.tv_usec <= 0)) {
-        tv.tv_sec = 0;
-        tv.tv_usec = 100;
-    }
-
-    platform_net_socket_setsockopt(fd, SOL_SOCKET, SO_RCVTIMEO, (char *)&tv, sizeof(struct timeval));
+    platform_timer_init(&timer);
+    platform_timer_cutdown(&timer, (timeout > 0) ? timeout : 0);
 
     while (nleft > 0) {
-        nread = platform_net_socket_recv(fd, ptr, nleft, 0);
-        if (nread < 0) {
-            return -1;
+        nread = platform_net_socket_recv(fd, ptr, nleft, MSG_DONTWAIT);
+        if (nread > 0) {
+            nleft -= nread;
+            ptr += nread;
+            continue;
         } else if (nread == 0) {
-            break;
+            break;      /* the peer has closed the connection */
         }
 
-        nleft -= nread;
-        ptr += nread;
+        if (errno == EINTR)
+            continue;
+
+        if ((errno != EAGAIN) && (errno != EWOULDBLOCK))
+            return -1;
+
+        rc = platform_net_socket_wait(fd, POLLIN, &timer);
+        if (rc < 0)
+            return -1;
+        else if (rc == 0)
+            break;      /* timeout, return what has been read so far */
     }
     return len - nleft;
 }
 
+int platform_net_socket_recv_some(int fd, unsigned char *buf, int len, int timeout)
+{
+    int rc;
+    int nread;
+    platform_timer_t timer;
+
+    platform_timer_init(&timer);
+    platform_timer_cutdown(&timer, (timeout > 0) ? timeout : 0);
+
+    while (1) {
+        nread = platform_net_socket_recv(fd, buf, len, MSG_DONTWAIT);
+        if (nread > 0)
+            return nread;
+
+        /* recv() returns 0 when the peer has closed the connection */
+        if (nread == 0)
+            return -1;
+
+        if (errno == EINTR)
+            continue;
+
+        if ((errno != EAGAIN) && (errno != EWOULDBLOCK))
+            return -1;
+
+        rc = platform_net_socket_wait(fd, POLLIN, &timer);
+        if (rc <= 0)
+            return rc;
+    }
+}
+
 int platform_net_socket_write(int fd, void *buf, size_t len)
 {
     return write(fd, buf, len);
@@ -88,19 +559,93 @@ int platform_net_socket_write(int fd, void *buf, size_t len)
 
 int platform_net_socket_write_timeout(int fd, unsigned char *buf, int len, int timeout)
 {
-    struct timeval tv = {
-        timeout / 1000, 
-        (timeout % 1000) * 1000
-    };
-    
-    if (tv.tv_sec < 0 || (tv.tv_sec == 0 && tv.tv_usec <= 0)) {
-        tv.tv_sec = 0;
-        tv.tv_usec = 100;
+    int rc;
+    int nwrite;
+    platform_timer_t timer;
+
+    platform_timer_init(&timer);
+    platform_timer_cutdown(&timer, (timeout > 0) ? timeout : 0);
+
+    while (1) {
+        nwrite = send(fd, buf, len, MSG_DONTWAIT | MSG_NOSIGNAL);
+        if (nwrite >= 0)
+            return nwrite;
+
+        if (errno == EINTR)
+            continue;
+
+        if ((errno != EAGAIN) && (errno != EWOULDBLOCK))
+            return -1;
+
+        rc = platform_net_socket_wait(fd, POLLOUT, &timer);
+        if (rc <= 0)
+            return rc;
+    }
+}
+
+int platform_net_socket_writev_timeout(int fd, mqtt_iovec_t *iov, int iovcnt, int timeout)
+{
+    int i, rc;
+    int nwrite;
+    struct msghdr msg;
+    struct iovec vec[MQTT_IOV_MAX];
+    platform_timer_t timer;
+
+    if ((iovcnt <= 0) || (iovcnt > MQTT_IOV_MAX))
+        return -1;
+
+    for (i = 0; i < iovcnt; i++) {
+        vec[i].iov_base = iov[i].buf;
+        vec[i].iov_len = iov[i].len;
     }
 
-    setsockopt(fd, SOL_SOCKET, SO_SNDTIMEO, (char *)&tv,sizeof(struct timeval));
-    
-    return write(fd, buf, len);
+    memset(&msg, 0, sizeof(msg));
+    msg.msg_iov = vec;
+    msg.msg_iovlen = iovcnt;
+
+    platform_timer_init(&timer);
+    platform_timer_cutdown(&timer, (timeout > 0) ? timeout : 0);
+
+    while (1) {
+        nwrite = sendmsg(fd, &msg, MSG_DONTWAIT | MSG_NOSIGNAL);
+        if (nwrite >= 0)
+            return nwrite;
+
+        if (errno == EINTR)
+            continue;
+
+        if ((errno != EAGAIN) && (errno != EWOULDBLOCK))
+            return -1;
+
+        rc = platform_net_socket_wait(fd, POLLOUT, &timer);
+        if (rc <= 0)
+            return rc;
+    }
+}
+
+/* 套接字是阻塞的，先等待可写再调用 sendfile，单次阻塞时间取决于 len */
+int platform_net_socket_sendfile_timeout(int fd, int in_fd, uint32_t offset, int len, int timeout)
+{
+    int rc;
+    ssize_t nwrite;
+    off_t off = (off_t)offset;
+    platform_timer_t timer;
+
+    platform_timer_init(&timer);
+    platform_timer_cutdown(&timer, (timeout > 0) ? timeout : 0);
+
+    while (1) {
+        rc = platform_net_socket_wait(fd, POLLOUT, &timer);
+        if (rc <= 0)
+            return rc;
+
+        nwrite = sendfile(fd, in_fd, &off, len);
+        if (nwrite >= 0)
+            return (int)nwrite;
+
+        if ((errno != EINTR) && (errno != EAGAIN) && (errno != EWOULDBLOCK))
+            return -1;
+    }
 }
 
 int platform_net_socket_close(int fd)
@@ -12,6 +12,7 @@
 #include <sys/param.h>
 #include <sys/time.h>
 #include <sys/select.h>
+#include <poll.h>
 #include <netinet/in.h>
 #include <netinet/tcp.h>
 #include <arpa/inet.h>
@@ -24,6 +25,11 @@
 #include <stdlib.h>
 #include <string.h>
 #include <signal.h>
+#include <sys/uio.h>
+#include <sys/sendfile.h>
+#include <stdint.h>
+
+#include "mqtt_iovec.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -32,11 +38,38 @@ extern "C" {
 #define PLATFORM_NET_PROTO_TCP  0 /**< The TCP transport protocol */
 #define PLATFORM_NET_PROTO_UDP  1 /**< The UDP transport protocol */
 
+#define PLATFORM_NET_SOCKET_SENDFILE  /**< platform_net_socket_sendfile_timeout() is available */
+#define PLATFORM_NET_SOCKET_CONNECT_TIMEOUT /**< platform_net_socket_connect_timeout() is available */
+
+#ifndef PLATFORM_NET_CONNECT_ATTEMPT_DELAY
+#define PLATFORM_NET_CONNECT_ATTEMPT_DELAY  250 /**< ms before racing the next address (RFC 8305) */
+#endif
+
+#ifndef PLATFORM_NET_CONNECT_ATTEMPT_MAX
+#define PLATFORM_NET_CONNECT_ATTEMPT_MAX    8   /**< resolved addresses tried per connect */
+#endif
+
+#ifndef PLATFORM_NET_DNS_CACHE_TTL
+#define PLATFORM_NET_DNS_CACHE_TTL          300000  /**< ms a resolved host:port is reused before it is refreshed, 0 disables the cache */
+#endif
+
+#ifndef PLATFORM_NET_DNS_CACHE_SIZE
+#define PLATFORM_NET_DNS_CACHE_SIZE         8   /**< host:port entries in the resolved-address cache */
+#endif
+
+#ifndef PLATFORM_NET_DNS_HOST_MAX
+#define PLATFORM_NET_DNS_HOST_MAX           128 /**< longer host names are not cached */
+#endif
+
 int platform_net_socket_connect(const char *host, const char *port, int proto);
+int platform_net_socket_connect_timeout(const char *host, const char *port, int proto, int timeout);
 int platform_net_socket_recv(int fd, void *buf, size_t len, int flags);
 int platform_net_socket_recv_timeout(int fd, unsigned char *buf, int len, int timeout);
+int platform_net_socket_recv_some(int fd, unsigned char *buf, int len, int timeout);
 int platform_net_socket_write(int fd, void *buf, size_t len);
 int platform_net_socket_write_timeout(int fd, unsigned char *buf, int len, int timeout);
+int platform_net_socket_writev_timeout(int fd, mqtt_iovec_t *iov, int iovcnt, int timeout);
+int platform_net_socket_sendfile_timeout(int fd, int in_fd, uint32_t offset, int len, int timeout);
 int platform_net_socket_close(int fd);
 int platform_net_socket_set_block(int fd);
 int platform_net_socket_set_nonblock(int fd);
@@ -21,10 +21,13 @@ platform_thread_t *platform_thread_init( const char *name,
 
     thread_entry = (void *(*)(void*))entry;
     thread = platform_memory_alloc(sizeof(platform_thread_t));
+    if (NULL == thread)
+        return NULL;
     
     res = pthread_create(&thread->thread, NULL, thread_entry, param);
     if(res != 0) {
         platform_memory_free(thread);
+        return NULL;
     }
 
     thread->mutex = (pthread_mutex_t)PTHREAD_MUTEX_INITIALIZER;
@@ -2,44 +2,49 @@
  * @Author: jiejie
  * @Github: https://github.com/jiejieTop
  * @Date: 2019-12-10 22:16:41
- * @LastEditTime: 2020-06-05 17:18:48
+ * @LastEditTime: 2026-10-17 15:20:11
  * @Description: the code belongs to jiejie, please keep the author information and source code according to the license.
  */
 
 #include "platform_timer.h"
 
+/* 
+ * 使用单调时钟，系统时间被 NTP 或手动调整时超时不受影响；
+ * 定时器只需要毫秒精度，优先使用开销更低的 COARSE 时钟（精度为一个系统 tick）
+ */
+#ifdef CLOCK_MONOTONIC_COARSE
+    #define PLATFORM_TIMER_CLOCK    CLOCK_MONOTONIC_COARSE
+#else
+    #define PLATFORM_TIMER_CLOCK    CLOCK_MONOTONIC
+#endif
+
 void platform_timer_init(platform_timer_t* timer)
 {
-    timer->time = (struct timeval){0, 0};
+    timer->time = 0;
 }
 
 void platform_timer_cutdown(platform_timer_t* timer, unsigned int timeout)
 {
-    struct timeval now;
-    gettimeofday(&now, NULL);
-    struct timeval interval = {timeout / 1000, (timeout % 1000) * 1000};
-    timeradd(&now, &interval, &timer->time);
+    timer->time = platform_timer_now() + timeout;
 }
 
 char platform_timer_is_expired(platform_timer_t* timer)
 {
-    struct timeval now, res;
-    gettimeofday(&now, NULL);
-    timersub(&timer->time, &now, &res);
-    return ((res.tv_sec < 0) || (res.tv_sec == 0 && res.tv_usec <= 0));
+    return ((long)(timer->time - platform_timer_now()) <= 0);
 }
 
 int platform_timer_remain(platform_timer_t* timer)
 {
-    struct timeval now, res;
-    gettimeofday(&now, NULL);
-    timersub(&timer->time, &now, &res);
-    return (res.tv_sec < 0) ? 0 : res.tv_sec * 1000 + res.tv_usec / 1000;
+    long remain = (long)(timer->time - platform_timer_now());
+    return (remain < 0) ? 0 : (int)remain;
 }
 
+/* 与其他平台一致，返回系统启动以来的毫秒数 */
 unsigned long platform_timer_now(void)
 {
-    return (unsigned long) time(NULL);
+    struct timespec now;
+    clock_gettime(PLATFORM_TIMER_CLOCK, &now);
+    return (unsigned long) now.tv_sec * 1000 + now.tv_nsec / 1000000;
 }
 
 void platform_timer_usleep(unsigned long usec)
@@ -18,7 +18,7 @@ extern "C" {
 #endif
 
 typedef struct platform_timer {
-    struct timeval time;
+    unsigned long time;         /* 到期时间，platform_timer_now() 的毫秒数 */
 } platform_timer_t;
 
 void platform_timer_init(platform_timer_t* timer);